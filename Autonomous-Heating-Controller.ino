@@ -10,7 +10,11 @@
 #include "led.h"
 #include <ArduinoOTA.h>
 #include "history.h"
+#include "phases.h"
 #include "ntp.h"
+#include "status.h"
+#include "metrics.h"
+#include "mqttqueue.h"
 
 /***************** setup *******************************************************
  * Description:
@@ -35,6 +39,8 @@ void setup()
   initWebServer();       // local web UI
   initNtp();        // falls noch nicht aufgerufen; ist idempotent
   initHistory();    // mount FS + Ringpuffer bereitstellen
+  initPhaseLog();   // Heizphasen-Log (braucht FS)
+  initMqttQueue();  // MQTT-Rückstau vom letzten Boot (braucht FS)
 
   Serial.println(F("[SYS] Setup complete."));
 }
@@ -54,12 +60,13 @@ void loop()
   }
   handleLed();             // LED status indicator
   ensureWifi();            // reconnect WiFi if needed
-  ensureMQTT();            // reconnect MQTT if needed
-  handleSensor();          // update readings
-  handleControl();         // apply control logic
+  metricsTime(LT_MQTT, ensureMQTT);            // reconnect MQTT if needed
+  metricsTime(LT_SENSOR, handleSensor);        // update readings
+  metricsTime(LT_CONTROL, handleControl);      // apply control logic
+  handleStatus();          // state version for /api/status
   handleOta();             // process OTA updates
-  handleWebServer();       // serve web requests
+  metricsTime(LT_WEB, handleWebServer);        // serve web requests
   handleMdns();
   ntpTick();               // <<< NTP tick
-  handleHistory();         // log history
+  metricsTime(LT_HISTORY, handleHistory);      // log history
 }
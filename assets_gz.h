@@ -0,0 +1,544 @@
+// Generated by tools/gen_assets.py from web/ - do not edit.
+#ifndef ASSETS_GZ_H
+#define ASSETS_GZ_H
+
+#include <Arduino.h>
+
+// web/app.css: 4563 bytes, gzip 1649 bytes
+#define APP_CSS_TYPE "text/css"
+#define APP_CSS_ETAG "\"3ef9e14ea65f1f02\""
+#define APP_CSS_VER  "3ef9e14e"
+static const size_t  APP_CSS_GZ_LEN = 1649;
+static const uint8_t APP_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0x4b, 0x8f, 0xdb, 0x36,
+  0x10, 0xbe, 0xef, 0xaf, 0x10, 0x60, 0x14, 0x58, 0x07, 0x92, 0x22, 0x51, 0x0f, 0xdb, 0x12, 0x5a,
+  0x34, 0x0d, 0x5a, 0xb4, 0x97, 0x1e, 0x1a, 0xe4, 0x50, 0x14, 0x3d, 0x50, 0x12, 0x65, 0x33, 0x2b,
+  0x89, 0x02, 0x45, 0xad, 0xed, 0x08, 0xfb, 0xdf, 0x3b, 0x7c, 0xc8, 0x92, 0xbc, 0xde, 0x4d, 0xd2,
+  0xa2, 0x49, 0x76, 0x63, 0x0e, 0xc9, 0x99, 0x6f, 0x5e, 0x1f, 0x49, 0x27, 0x9c, 0x31, 0x31, 0x38,
+  0x4e, 0xb6, 0x4f, 0x56, 0x5e, 0xe6, 0x23, 0xe4, 0xa5, 0x8e, 0x93, 0x63, 0x5e, 0x24, 0x2b, 0xdf,
+  0xf3, 0x71, 0x10, 0xc0, 0x50, 0x90, 0x93, 0x48, 0x56, 0x64, 0x47, 0x48, 0x99, 0xc3, 0xb0, 0xee,
+  0x05, 0x81, 0xe9, 0x6c, 0x93, 0x23, 0xb2, 0x85, 0x71, 0xc6, 0x78, 0x41, 0x78, 0xb2, 0x42, 0x28,
+  0xf0, 0xa2, 0x48, 0xad, 0xaf, 0x5b, 0xa7, 0xa2, 0x0d, 0x49, 0x56, 0x65, 0xb6, 0x43, 0x81, 0xdc,
+  0xd4, 0xb7, 0x2d, 0xe1, 0x46, 0x88, 0x50, 0x1e, 0x45, 0x04, 0x84, 0x15, 0x3b, 0x5e, 0x84, 0xb1,
+  0x87, 0xa3, 0x12, 0x83, 0xb0, 0x3d, 0xe0, 0x8e, 0x18, 0x21, 0xde, 0x46, 0x51, 0xb9, 0x01, 0xe1,
+  0x81, 0x60, 0xe1, 0x64, 0xb8, 0x29, 0x12, 0xbe, 0xcf, 0xf0, 0x3d, 0x0a, 0x76, 0x76, 0xbc, 0x95,
+  0xff, 0x3c, 0xd7, 0x8f, 0xd7, 0xb0, 0xa0, 0xc0, 0xcd, 0x1e, 0x40, 0x3c, 0x62, 0x7e, 0x0f, 0x88,
+  0x70, 0x21, 0x65, 0x38, 0xcf, 0x49, 0x03, 0xc8, 0x37, 0x18, 0xa3, 0xb2, 0xbc, 0x08, 0x10, 0x18,
+  0x0b, 0x0b, 0x2d, 0x81, 0x95, 0x00, 0xb2, 0x8c, 0xb3, 0x38, 0x83, 0x11, 0x7b, 0x48, 0x56, 0x41,
+  0x54, 0x78, 0x1b, 0x39, 0xd5, 0x1d, 0x70, 0xc1, 0x8e, 0x4e, 0xc7, 0x4a, 0x91, 0x78, 0x96, 0xef,
+  0xb5, 0x27, 0x2b, 0x90, 0xbf, 0x14, 0x00, 0xcf, 0x96, 0x7f, 0xdd, 0x20, 0x5a, 0xa7, 0x4f, 0x77,
+  0x3f, 0xd6, 0xa4, 0xa0, 0xd8, 0xba, 0x6f, 0x39, 0x29, 0x09, 0xef, 0x9c, 0x9c, 0x55, 0x8c, 0x3b,
+  0x5d, 0x7e, 0x20, 0x35, 0x49, 0xac, 0x8a, 0xee, 0x0f, 0x62, 0x3d, 0x24, 0xb3, 0x40, 0x97, 0x71,
+  0xb9, 0x29, 0xb3, 0x4b, 0xa0, 0x4b, 0xf5, 0xe7, 0x12, 0x68, 0x1f, 0xa3, 0x20, 0xf4, 0xa6, 0x40,
+  0x47, 0xdb, 0xd8, 0xdb, 0xe0, 0x59, 0xa0, 0x8b, 0x5d, 0x51, 0x90, 0xfc, 0x19, 0xc4, 0x2d, 0x80,
+  0x43, 0xe1, 0x88, 0xd0, 0x8f, 0x6d, 0x14, 0xdb, 0x91, 0x6f, 0xbb, 0x3e, 0x02, 0x90, 0x4f, 0x77,
+  0x19, 0x2b, 0xce, 0x43, 0xc9, 0x1a, 0xe1, 0x94, 0xb8, 0xa6, 0xd5, 0x39, 0xe9, 0xce, 0x1d, 0x64,
+  0xca, 0xe9, 0xa9, 0xed, 0xe0, 0xb6, 0xad, 0x88, 0xa3, 0x05, 0xf6, 0x07, 0xb2, 0x67, 0xc4, 0xfa,
+  0xf8, 0x9b, 0xfd, 0x07, 0xcb, 0x98, 0x60, 0xf6, 0xc7, 0xac, 0x6f, 0x44, 0x6f, 0xbf, 0xc7, 0x8d,
+  0xc0, 0x9c, 0x54, 0x95, 0xfd, 0x3b, 0x48, 0xad, 0x0f, 0xb8, 0xe9, 0xec, 0x5f, 0x49, 0xf5, 0x48,
+  0x04, 0xcd, 0xb1, 0xfd, 0x8e, 0x53, 0x5c, 0xd9, 0xef, 0xa4, 0x1e, 0xeb, 0xbd, 0xf4, 0xdf, 0xfa,
+  0xb9, 0x66, 0x9f, 0xe8, 0x45, 0x99, 0x1e, 0xa6, 0x35, 0xe6, 0x7b, 0xda, 0x24, 0x3e, 0x27, 0x75,
+  0x9a, 0xe1, 0xfc, 0x61, 0xcf, 0x59, 0x0f, 0x49, 0x35, 0x69, 0xdb, 0xaf, 0x53, 0x15, 0x3b, 0x33,
+  0x96, 0xe1, 0x58, 0xa7, 0x82, 0x83, 0x25, 0x2a, 0x28, 0x6b, 0x92, 0x69, 0x87, 0xe5, 0xa2, 0xa8,
+  0xb3, 0x08, 0x54, 0x8a, 0xad, 0x76, 0x4c, 0x63, 0xc8, 0xc7, 0x01, 0x0d, 0xda, 0x0e, 0x44, 0x4c,
+  0x08, 0x56, 0x27, 0x2e, 0x92, 0xf6, 0x9e, 0xee, 0x5c, 0x19, 0xef, 0xe1, 0x99, 0x5d, 0x29, 0x5d,
+  0xa7, 0x26, 0xba, 0x3e, 0x04, 0xb0, 0x63, 0x15, 0x2d, 0x2c, 0x03, 0x4a, 0x89, 0xc7, 0x69, 0x87,
+  0xe3, 0x82, 0xf6, 0x5d, 0xe2, 0xee, 0xa4, 0xc6, 0x16, 0x17, 0x05, 0x6d, 0xf6, 0xc6, 0x1d, 0x76,
+  0x32, 0x09, 0x31, 0x6a, 0x67, 0xd9, 0x59, 0xa7, 0x4b, 0x40, 0xbe, 0xc1, 0xb3, 0xe7, 0xb4, 0x18,
+  0x0a, 0xda, 0xb5, 0x15, 0x3e, 0x27, 0x72, 0x90, 0xca, 0x5f, 0xaa, 0x81, 0x2a, 0x2c, 0x88, 0xac,
+  0xa4, 0xbe, 0x6e, 0xba, 0x24, 0xaf, 0x70, 0xdd, 0xde, 0x47, 0xca, 0x0f, 0x1b, 0x85, 0x8f, 0x47,
+  0x7b, 0xe7, 0x46, 0xf0, 0x79, 0x6d, 0xd5, 0xb4, 0xa9, 0xf1, 0x09, 0xea, 0xd1, 0x2f, 0xf9, 0xda,
+  0x42, 0x6e, 0x0c, 0x52, 0xf3, 0x5f, 0xaa, 0x77, 0x3b, 0x7b, 0xdc, 0x26, 0x6e, 0x28, 0x05, 0x1c,
+  0xe0, 0xa8, 0x51, 0x24, 0x37, 0xa7, 0x18, 0x4a, 0xb3, 0x71, 0x28, 0x58, 0x03, 0x0b, 0xd0, 0x18,
+  0x84, 0x8f, 0x98, 0x7e, 0x78, 0x33, 0x80, 0x62, 0xe7, 0x48, 0x0b, 0x71, 0x48, 0xbc, 0x51, 0x6a,
+  0x55, 0x38, 0x23, 0xd5, 0x70, 0x3c, 0xc0, 0x16, 0xa7, 0x6b, 0x71, 0x4e, 0x92, 0x86, 0x1d, 0x39,
+  0x6e, 0x53, 0xf6, 0x48, 0x78, 0x09, 0xdd, 0x9c, 0x1c, 0x28, 0x94, 0x66, 0x93, 0xca, 0xcc, 0x39,
+  0x17, 0x21, 0xd4, 0x0c, 0x6d, 0x3b, 0xda, 0x5d, 0xf4, 0xd0, 0xa6, 0xed, 0xc5, 0x70, 0x20, 0xb2,
+  0x33, 0x12, 0xa4, 0xb3, 0x33, 0xc6, 0x52, 0x21, 0xb5, 0xb4, 0x03, 0x73, 0x0c, 0x2a, 0xbc, 0xf4,
+  0xb3, 0x5c, 0x62, 0x52, 0x01, 0x92, 0x8b, 0x46, 0x37, 0x13, 0xcd, 0xa4, 0x30, 0x58, 0x6e, 0x36,
+  0x82, 0xc5, 0x60, 0x34, 0xe7, 0xa5, 0x63, 0xf8, 0x69, 0x23, 0x39, 0xc7, 0x29, 0x2b, 0x72, 0xba,
+  0x15, 0x99, 0x4f, 0x7d, 0x27, 0x68, 0x79, 0x86, 0x94, 0xc0, 0x10, 0x58, 0x65, 0x0a, 0x98, 0x34,
+  0x3d, 0xa1, 0x8f, 0x14, 0xfc, 0x9d, 0xae, 0x88, 0x6f, 0xa9, 0xa8, 0xcd, 0x55, 0x4f, 0xa8, 0xba,
+  0x6f, 0xa1, 0xe3, 0x1a, 0x71, 0xa3, 0x2b, 0xf2, 0x9e, 0x77, 0x20, 0x6a, 0x19, 0x55, 0x30, 0x66,
+  0x4d, 0xa2, 0x3e, 0x96, 0x8c, 0x03, 0x0a, 0x6f, 0x6b, 0x7a, 0xc4, 0x9a, 0x77, 0x8e, 0x3f, 0x76,
+  0x8e, 0x01, 0x60, 0x1a, 0x68, 0x14, 0xab, 0xc0, 0x2d, 0x43, 0xa9, 0x9d, 0x4c, 0x0e, 0x32, 0xa3,
+  0xf3, 0xf6, 0xd1, 0x44, 0x83, 0x90, 0xed, 0xc7, 0xc8, 0x46, 0x51, 0xa4, 0xb9, 0x66, 0xae, 0xf6,
+  0xc6, 0x92, 0x48, 0x71, 0xa6, 0x52, 0x88, 0x73, 0x41, 0x1f, 0xc9, 0x70, 0x41, 0xac, 0xb1, 0xcb,
+  0xca, 0xff, 0xf3, 0x1e, 0xa2, 0x26, 0xd7, 0xe9, 0x52, 0x59, 0x86, 0xf7, 0x7f, 0x0d, 0xac, 0xae,
+  0x12, 0xdf, 0xf3, 0xbe, 0x7b, 0xb9, 0xe4, 0x3a, 0x81, 0x45, 0xdf, 0x39, 0xd0, 0x4e, 0x97, 0xe6,
+  0x55, 0x65, 0xa3, 0x7a, 0x4b, 0x55, 0xae, 0x1c, 0x3a, 0xb2, 0x35, 0x12, 0xd5, 0x1f, 0x5f, 0x51,
+  0x4f, 0xaa, 0x9f, 0x9c, 0x8c, 0x88, 0x23, 0x81, 0x06, 0x9a, 0x8c, 0xc8, 0x4d, 0x93, 0xff, 0xba,
+  0xba, 0x36, 0xb3, 0x28, 0x5c, 0xb9, 0xf9, 0x7a, 0x64, 0x26, 0xb5, 0xec, 0x61, 0x78, 0x9e, 0xa7,
+  0x28, 0xb0, 0x91, 0xb7, 0xb5, 0x7d, 0xb4, 0x81, 0x34, 0xad, 0xd3, 0xeb, 0x4c, 0xcf, 0xa7, 0xbd,
+  0xed, 0x5c, 0x1b, 0x1c, 0xa3, 0x37, 0xd4, 0xc9, 0x74, 0xfb, 0xde, 0x46, 0xfd, 0xdc, 0xd2, 0xb7,
+  0x98, 0x37, 0x0a, 0xd5, 0x99, 0x37, 0xcc, 0xd3, 0xa2, 0x24, 0xda, 0x58, 0x5b, 0x51, 0xf1, 0x35,
+  0x74, 0x09, 0x5c, 0x68, 0xc1, 0x8f, 0xca, 0x87, 0xa1, 0x5a, 0x7d, 0x46, 0xdf, 0x03, 0x57, 0x1a,
+  0x52, 0xd8, 0x86, 0x70, 0x98, 0xaf, 0x07, 0xa3, 0xf4, 0x45, 0x3d, 0xe9, 0x93, 0x26, 0xe9, 0xaf,
+  0xe0, 0xe5, 0x00, 0x49, 0x5e, 0xbe, 0xc9, 0xca, 0xa1, 0x66, 0xe5, 0xf0, 0x75, 0x56, 0xd6, 0xc5,
+  0xfd, 0xa4, 0x4f, 0xa9, 0x4b, 0xca, 0x77, 0x5a, 0x78, 0x8b, 0x38, 0xfd, 0xd9, 0xd4, 0x92, 0x01,
+  0xd1, 0x35, 0x03, 0xa2, 0x39, 0x03, 0xea, 0xe3, 0xf0, 0x46, 0x50, 0xc2, 0xad, 0x0e, 0xca, 0x17,
+  0x5d, 0x0e, 0xdd, 0xad, 0x72, 0x59, 0x1e, 0x45, 0x9b, 0x17, 0x8e, 0x22, 0xa4, 0x9d, 0x46, 0xd7,
+  0x4e, 0x07, 0xd1, 0xd2, 0x6b, 0x05, 0x46, 0x1c, 0x6c, 0x31, 0x73, 0x3a, 0xd0, 0x85, 0x1e, 0x18,
+  0xa0, 0x6e, 0x4b, 0xab, 0x6a, 0xb8, 0x62, 0xea, 0xac, 0x62, 0xf9, 0xc3, 0x74, 0x6e, 0x28, 0x73,
+  0xe6, 0x64, 0x5b, 0xb6, 0xc6, 0x6e, 0xb7, 0x6b, 0x4f, 0x5f, 0x6a, 0x0d, 0x75, 0x33, 0x82, 0x6e,
+  0x27, 0x89, 0xbb, 0x8d, 0x0c, 0xe4, 0x1b, 0x35, 0x78, 0xe0, 0x63, 0x90, 0x7d, 0xa9, 0xf3, 0xd9,
+  0x15, 0xc6, 0x68, 0x33, 0xf7, 0x1c, 0x15, 0x25, 0xcb, 0x4b, 0x19, 0x34, 0x37, 0x15, 0x67, 0x18,
+  0x83, 0x8e, 0x82, 0x08, 0x4c, 0xab, 0xce, 0xea, 0xfa, 0x1a, 0x96, 0x9d, 0x87, 0x2b, 0x2a, 0x9f,
+  0xdb, 0xd5, 0x17, 0x56, 0x69, 0x18, 0x0f, 0xcf, 0xe5, 0xc0, 0xb5, 0xea, 0xa0, 0x85, 0xcb, 0x20,
+  0xe3, 0x58, 0x91, 0x7f, 0xc3, 0x1a, 0x22, 0x3b, 0xa5, 0xc6, 0x10, 0xaf, 0x99, 0x4b, 0x3b, 0x43,
+  0xe3, 0x8f, 0x94, 0x1c, 0x7f, 0x12, 0x4d, 0x77, 0x83, 0xb7, 0xa2, 0x1b, 0xbc, 0x35, 0xba, 0xa1,
+  0xea, 0xd7, 0xb3, 0x46, 0x77, 0x66, 0x8a, 0xac, 0xe5, 0xf1, 0x67, 0xf2, 0xa6, 0xb8, 0xe8, 0xb9,
+  0x79, 0x81, 0xb3, 0x8a, 0x0c, 0x0b, 0x86, 0x1d, 0x39, 0xa3, 0xc2, 0x6d, 0x47, 0x92, 0xf1, 0xc3,
+  0x62, 0xaf, 0xb9, 0xbc, 0x5d, 0x55, 0x88, 0xbe, 0x26, 0x04, 0xf3, 0x74, 0x8f, 0x97, 0xab, 0x17,
+  0x32, 0xac, 0x62, 0xa5, 0x98, 0x38, 0xa9, 0x48, 0x29, 0x40, 0xe5, 0xea, 0x40, 0x3b, 0xf1, 0xe1,
+  0x71, 0x6f, 0xb9, 0x97, 0x27, 0xcb, 0xd0, 0x09, 0xce, 0x1e, 0xc8, 0xe5, 0x48, 0x30, 0x62, 0xa8,
+  0x0f, 0xa8, 0x40, 0x15, 0xde, 0x54, 0xaf, 0x30, 0x1d, 0xe3, 0x43, 0x4a, 0x8d, 0x40, 0xae, 0xcb,
+  0x21, 0x72, 0xaa, 0x1e, 0xe6, 0xc2, 0x4f, 0x90, 0x59, 0x23, 0x7d, 0x66, 0x73, 0x0f, 0x17, 0xa4,
+  0xd1, 0xa6, 0x21, 0x45, 0xdf, 0xf6, 0xc3, 0xd8, 0x8e, 0xcd, 0xf3, 0xe2, 0x05, 0xbb, 0xe1, 0xbf,
+  0xb5, 0x3a, 0x3d, 0xc4, 0x96, 0xae, 0x4e, 0xf2, 0x97, 0x7d, 0x1d, 0x87, 0x05, 0x86, 0xbb, 0x2d,
+  0xe7, 0x50, 0x3e, 0xa1, 0x1d, 0x2e, 0xb4, 0x4f, 0x2f, 0xba, 0xa5, 0xf6, 0x49, 0xfe, 0x5f, 0xb4,
+  0x4f, 0x4f, 0xc3, 0xa5, 0xf6, 0x49, 0xfe, 0xad, 0xda, 0x17, 0x8d, 0x39, 0x19, 0xc2, 0x27, 0xda,
+  0x8d, 0x26, 0x56, 0x71, 0xb6, 0x41, 0x5b, 0xef, 0x5a, 0xdd, 0x64, 0x67, 0xbe, 0x51, 0x71, 0xe6,
+  0x1c, 0xa0, 0xbe, 0xff, 0x84, 0x70, 0x6a, 0xc6, 0x81, 0xed, 0x6f, 0x43, 0x1b, 0x1e, 0x2a, 0xeb,
+  0xaf, 0xd3, 0x95, 0xed, 0x07, 0x35, 0x31, 0x3d, 0x8e, 0xae, 0x21, 0x3a, 0xfa, 0x42, 0x3e, 0x5b,
+  0x65, 0x88, 0x6a, 0x6a, 0x1f, 0xf9, 0x6e, 0x4d, 0x17, 0xaf, 0x3e, 0xb8, 0xfc, 0x38, 0x1d, 0xe1,
+  0xb4, 0x5c, 0xa8, 0x53, 0x77, 0xbb, 0x05, 0xf2, 0x15, 0x89, 0xc8, 0x86, 0x64, 0x5f, 0x0c, 0x23,
+  0x5c, 0xeb, 0x6e, 0x68, 0x2a, 0xe0, 0xb1, 0x3b, 0x47, 0x8f, 0x8b, 0xf5, 0x8d, 0x55, 0xb2, 0x25,
+  0xe7, 0xcb, 0xf4, 0x15, 0x6c, 0x86, 0xde, 0x7f, 0x0d, 0xbd, 0xab, 0xbe, 0x15, 0x60, 0x8d, 0xfa,
+  0x62, 0x60, 0xae, 0xe6, 0xf2, 0x6d, 0x81, 0xb4, 0xf9, 0xf6, 0x8d, 0x05, 0x1c, 0x01, 0xe6, 0xac,
+  0xa6, 0xaf, 0x33, 0xc2, 0xf5, 0x21, 0x6a, 0x75, 0x2d, 0x6d, 0x1a, 0x78, 0xad, 0x5b, 0x6f, 0xde,
+  0xea, 0x4b, 0xe6, 0x5f, 0xe2, 0xdc, 0x92, 0xef, 0xf5, 0x9a, 0xbf, 0xef, 0x86, 0x3b, 0xcb, 0x72,
+  0x6a, 0xf6, 0x59, 0x3e, 0x8d, 0x09, 0x86, 0x1b, 0x23, 0x3c, 0x76, 0x2c, 0x09, 0xaf, 0xa4, 0xa4,
+  0x2a, 0x52, 0x0b, 0xb4, 0xfe, 0x42, 0xe1, 0xbd, 0xcf, 0x4e, 0x52, 0xc1, 0xd3, 0xdd, 0x0d, 0x1d,
+  0x49, 0xe2, 0x1c, 0x49, 0xf6, 0x40, 0x85, 0xa3, 0x2c, 0x39, 0xd2, 0xa2, 0x93, 0xf5, 0xc0, 0x51,
+  0x8d, 0xfd, 0xea, 0x72, 0x06, 0x49, 0x5c, 0x2c, 0xd7, 0x68, 0xcc, 0xec, 0x1c, 0x90, 0xaa, 0x19,
+  0x98, 0x33, 0x3c, 0x0d, 0xd4, 0x0c, 0x50, 0xfe, 0x01, 0x1b, 0x23, 0xec, 0x02, 0xd3, 0x11, 0x00,
+  0x00,
+};
+
+// web/app.js: 20188 bytes, gzip 6669 bytes
+#define APP_JS_TYPE "application/javascript"
+#define APP_JS_ETAG "\"ba6bd3fd11c7ef54\""
+#define APP_JS_VER  "ba6bd3fd"
+static const size_t  APP_JS_GZ_LEN = 6669;
+static const uint8_t APP_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3c, 0xcb, 0x72, 0xdb, 0x48,
+  0x92, 0x77, 0x7f, 0x45, 0x59, 0x11, 0x63, 0x00, 0x16, 0x09, 0x92, 0x6a, 0xbb, 0xa7, 0x87, 0x94,
+  0xe4, 0xb0, 0x25, 0x79, 0xec, 0x19, 0xbf, 0xd6, 0x54, 0xbb, 0x67, 0x46, 0xa1, 0xe8, 0x00, 0x89,
+  0x22, 0x09, 0x0b, 0x04, 0xd0, 0x40, 0x91, 0x22, 0xe5, 0x51, 0xc4, 0x1e, 0xf6, 0x0f, 0x76, 0xef,
+  0x73, 0xe9, 0xbd, 0xcf, 0x69, 0x4f, 0x7d, 0x1a, 0xff, 0xc9, 0x7e, 0xc1, 0x7e, 0xc2, 0x66, 0x66,
+  0x55, 0xa1, 0x0a, 0x0f, 0xca, 0xee, 0x89, 0xd8, 0x75, 0x84, 0x4d, 0xa0, 0x2a, 0x2b, 0x2b, 0x33,
+  0x2b, 0x2b, 0x5f, 0x55, 0x70, 0xaf, 0xc7, 0x5e, 0x45, 0x6b, 0xde, 0xfd, 0x3e, 0x0b, 0x03, 0xc1,
+  0x87, 0xac, 0xc7, 0xd7, 0x3c, 0x11, 0x05, 0x73, 0xc7, 0xe3, 0x33, 0x8f, 0x65, 0x81, 0x98, 0x2e,
+  0x04, 0x0b, 0x23, 0xce, 0xc6, 0x3c, 0x12, 0x7c, 0xc4, 0xd2, 0x45, 0xc2, 0x59, 0x3a, 0x9b, 0xf1,
+  0x84, 0x27, 0x6c, 0x2c, 0x72, 0x1e, 0x2c, 0xd9, 0x75, 0xc4, 0xef, 0xf5, 0x7a, 0x6c, 0x12, 0x15,
+  0x0b, 0x9e, 0xb3, 0x84, 0xaf, 0x58, 0x1c, 0x84, 0x3c, 0xf1, 0xef, 0xad, 0x83, 0x9c, 0xc5, 0x80,
+  0xfd, 0x4c, 0xe2, 0x3c, 0x62, 0xc9, 0x2a, 0x8e, 0x47, 0xf7, 0xee, 0xcd, 0x56, 0xc9, 0x54, 0x44,
+  0x69, 0xc2, 0x82, 0x99, 0xe0, 0xf9, 0x53, 0x7a, 0x76, 0xbd, 0x7b, 0x9f, 0xee, 0x31, 0x16, 0xcd,
+  0x98, 0x7b, 0xdf, 0x1a, 0xf3, 0xd7, 0xbf, 0x5a, 0x18, 0x7c, 0x98, 0x2e, 0xdc, 0x8e, 0x05, 0x50,
+  0xca, 0xee, 0x1f, 0x1d, 0xb1, 0x81, 0x07, 0x23, 0x70, 0x14, 0x03, 0x1a, 0x92, 0x30, 0xbd, 0xf6,
+  0xe3, 0x74, 0x1a, 0x20, 0x36, 0x80, 0xcc, 0xe2, 0x60, 0xca, 0x5d, 0xa7, 0xe7, 0x78, 0x23, 0x80,
+  0xb8, 0xbd, 0x77, 0x6b, 0xcd, 0x9b, 0xa5, 0x85, 0x50, 0xd3, 0xae, 0xf2, 0x58, 0xce, 0x3c, 0xe3,
+  0xc0, 0x2b, 0xbe, 0x76, 0x3e, 0x2d, 0xb9, 0x58, 0xa4, 0xe1, 0xd0, 0x79, 0xf7, 0x76, 0x7c, 0xee,
+  0x74, 0xa6, 0xc1, 0x74, 0xc1, 0x87, 0x4e, 0x92, 0x76, 0x0b, 0x91, 0xe6, 0xdc, 0xe9, 0xe4, 0x3c,
+  0x8c, 0x72, 0x3e, 0x15, 0x43, 0x67, 0x19, 0x24, 0xab, 0x20, 0x76, 0x6e, 0x3d, 0xa2, 0xc1, 0x17,
+  0x0b, 0x9e, 0xb8, 0x16, 0x4f, 0xaa, 0x79, 0x8a, 0x52, 0xac, 0xb4, 0x8f, 0x2a, 0xd4, 0x24, 0xab,
+  0x70, 0xce, 0xdd, 0x59, 0xc4, 0xe3, 0xb0, 0x13, 0xf2, 0x58, 0x04, 0x92, 0x20, 0x94, 0xde, 0x24,
+  0x0d, 0xb7, 0x47, 0x0e, 0x75, 0x1d, 0x39, 0xfb, 0x3c, 0x99, 0xa6, 0x21, 0xff, 0xfe, 0xfd, 0xcb,
+  0x93, 0x74, 0x99, 0xa5, 0xb0, 0x02, 0x42, 0x8e, 0xf2, 0xf6, 0x9d, 0x07, 0x34, 0xb0, 0x1d, 0x46,
+  0xe2, 0x1c, 0x95, 0x3c, 0x3a, 0x3d, 0x9a, 0xd1, 0xa9, 0x33, 0xba, 0x00, 0xe9, 0xf2, 0xbc, 0x18,
+  0x7e, 0x72, 0x4e, 0xd2, 0x44, 0xc0, 0xc8, 0xee, 0xf9, 0x36, 0xe3, 0xce, 0xd0, 0x09, 0xb2, 0x2c,
+  0x8e, 0xa4, 0x60, 0x7b, 0x9b, 0xee, 0xf5, 0xf5, 0x75, 0x77, 0x96, 0xe6, 0xcb, 0x2e, 0xc8, 0x4a,
+  0xce, 0x16, 0x3a, 0xb7, 0x1d, 0xa4, 0x74, 0x88, 0xff, 0xfc, 0xdf, 0xcb, 0x6b, 0xb6, 0x14, 0xaf,
+  0xa3, 0x64, 0x25, 0x78, 0xe1, 0x2e, 0xa3, 0xc4, 0x08, 0x6b, 0x01, 0x1a, 0xf6, 0x3a, 0x10, 0x0b,
+  0x7f, 0x16, 0xa7, 0x69, 0x8e, 0x7d, 0xac, 0xc7, 0xbe, 0xed, 0x7b, 0x1d, 0xb6, 0x84, 0x1e, 0x7c,
+  0xfd, 0x0d, 0xbc, 0xa2, 0x1c, 0x72, 0x2e, 0x56, 0x79, 0xc2, 0xdc, 0x05, 0x3b, 0x64, 0x83, 0x3e,
+  0x7b, 0xc2, 0x9c, 0xbe, 0xc3, 0x86, 0xcc, 0x71, 0x3c, 0xb6, 0x0f, 0x68, 0xf6, 0x19, 0x30, 0x0d,
+  0xff, 0xba, 0xcb, 0xb6, 0xfe, 0x65, 0x95, 0x9a, 0x82, 0x8b, 0x73, 0xbe, 0x11, 0x6e, 0x14, 0x76,
+  0x98, 0xd8, 0x08, 0x43, 0x0e, 0x8f, 0x61, 0xd6, 0x30, 0x9d, 0xae, 0x96, 0x20, 0x4a, 0x7f, 0xce,
+  0xc5, 0x59, 0xcc, 0xf1, 0xf1, 0xd9, 0xf6, 0x65, 0x08, 0xd0, 0xb4, 0x20, 0xa8, 0xee, 0x00, 0xf7,
+  0xe0, 0x01, 0x40, 0xfb, 0x02, 0xd0, 0x28, 0xc9, 0x93, 0x7a, 0x13, 0x36, 0xad, 0xe0, 0xb5, 0x7e,
+  0xea, 0x6d, 0x2a, 0x36, 0x10, 0xf3, 0x32, 0xc9, 0x56, 0xc2, 0x4d, 0x82, 0x25, 0xef, 0x00, 0x19,
+  0xf1, 0x2e, 0x7a, 0x7e, 0x5a, 0xf1, 0x7c, 0x3b, 0xe6, 0x31, 0xac, 0x0b, 0xc8, 0x6a, 0xef, 0x02,
+  0x07, 0x1c, 0x39, 0x7b, 0xc0, 0x1f, 0x3e, 0xc1, 0xcf, 0x9e, 0x73, 0xb9, 0xd7, 0xa0, 0x91, 0xe8,
+  0x2a, 0x71, 0x04, 0x30, 0x29, 0xec, 0x4d, 0xc9, 0x56, 0x85, 0x54, 0x98, 0x78, 0xc5, 0x61, 0x3a,
+  0xf8, 0x6d, 0x12, 0x89, 0xea, 0x44, 0xbb, 0x78, 0x55, 0xb8, 0x45, 0x75, 0xf9, 0x76, 0x89, 0xcb,
+  0x29, 0xc4, 0x0b, 0x0e, 0xdb, 0x3e, 0x77, 0x4a, 0x92, 0x16, 0x66, 0xc2, 0x85, 0x3f, 0x8d, 0x83,
+  0xa2, 0x78, 0x83, 0x84, 0x1f, 0x31, 0x80, 0x45, 0xd4, 0x5d, 0xb0, 0x57, 0x4b, 0x46, 0xcb, 0x58,
+  0xf8, 0x0b, 0x1a, 0x8c, 0x0b, 0xa9, 0x3a, 0xd3, 0x2b, 0x5a, 0x50, 0xf5, 0x36, 0x09, 0x42, 0x89,
+  0x18, 0x71, 0x55, 0xc5, 0x6c, 0x8f, 0xfd, 0x9f, 0xbf, 0xfd, 0xc7, 0x7f, 0xb2, 0x17, 0x3c, 0xba,
+  0x59, 0x25, 0x73, 0x76, 0xf6, 0xf2, 0x0d, 0xa1, 0xa8, 0x34, 0x3e, 0xfd, 0x7e, 0xec, 0x48, 0x86,
+  0x25, 0x4f, 0x60, 0x29, 0xef, 0xe2, 0x6a, 0x22, 0x12, 0xc9, 0xd6, 0xdb, 0xd9, 0xcc, 0x70, 0x06,
+  0x83, 0x0c, 0x6f, 0xf0, 0xe2, 0x2f, 0xa2, 0x10, 0xec, 0x29, 0x20, 0xba, 0xaf, 0xa9, 0xb1, 0xe7,
+  0x58, 0xde, 0x2d, 0xb7, 0xd7, 0x3f, 0x09, 0x61, 0x70, 0x2f, 0x0d, 0xe6, 0xe5, 0x17, 0xa5, 0xb6,
+  0x84, 0xa1, 0x5f, 0x23, 0xb3, 0x65, 0x43, 0x66, 0x7a, 0xe4, 0xeb, 0x7f, 0x39, 0x3f, 0x67, 0x1f,
+  0x78, 0x3e, 0x59, 0x25, 0xc0, 0x01, 0x0d, 0xa7, 0xa6, 0xdf, 0x73, 0x70, 0x1d, 0x49, 0x22, 0x4a,
+  0x61, 0xe9, 0x5d, 0x04, 0xd8, 0xcf, 0xf9, 0x32, 0x73, 0x3a, 0x80, 0x04, 0x50, 0x1d, 0x49, 0x9f,
+  0x81, 0xa8, 0x92, 0x80, 0xc6, 0x43, 0xb3, 0x2f, 0xd2, 0xe7, 0xd1, 0x86, 0x87, 0xee, 0xc0, 0x23,
+  0x02, 0xac, 0xb1, 0x63, 0x39, 0xb2, 0xc8, 0xee, 0x80, 0x79, 0x96, 0x82, 0xf5, 0x07, 0x03, 0x02,
+  0x90, 0xe0, 0xc0, 0xa2, 0x64, 0x0e, 0x9c, 0x4e, 0x54, 0x9b, 0x04, 0x26, 0xcb, 0x7b, 0xb7, 0x54,
+  0x09, 0x89, 0x11, 0xeb, 0xc4, 0x88, 0x75, 0x62, 0x96, 0xcb, 0xe0, 0x25, 0x4e, 0xfa, 0x3b, 0xb6,
+  0x02, 0x08, 0x6e, 0x16, 0xcd, 0xdd, 0xa9, 0xdc, 0x0a, 0xe5, 0x16, 0x76, 0xc2, 0x00, 0x36, 0xa8,
+  0x78, 0x97, 0x46, 0x20, 0xa7, 0x0e, 0x9b, 0xfa, 0xd6, 0x7b, 0x0b, 0x7b, 0x6a, 0x50, 0x12, 0xcd,
+  0x17, 0xa2, 0x32, 0xac, 0xd2, 0xb2, 0x7b, 0x20, 0x62, 0x17, 0x41, 0x8e, 0x63, 0x2c, 0x03, 0x2b,
+  0x67, 0xc5, 0xf6, 0xf6, 0x89, 0xda, 0x46, 0x98, 0x9e, 0xfa, 0x98, 0xc5, 0xb6, 0x00, 0xe5, 0xe5,
+  0x45, 0x54, 0x10, 0x65, 0xe6, 0x75, 0x37, 0x59, 0x5a, 0x82, 0x88, 0xdb, 0xac, 0xd8, 0xd4, 0xb7,
+  0xdb, 0xdb, 0xd5, 0x60, 0xea, 0x17, 0xbb, 0x98, 0x06, 0x07, 0x15, 0x9e, 0xcc, 0xe6, 0x25, 0x6f,
+  0xb0, 0x56, 0x86, 0xd1, 0x0a, 0x84, 0xe1, 0x85, 0x60, 0xcc, 0x6b, 0x03, 0x0f, 0x37, 0x58, 0xd4,
+  0xb4, 0x2d, 0x88, 0xb8, 0x8d, 0xa6, 0x04, 0x03, 0x8d, 0x80, 0xf8, 0xe9, 0x14, 0x9c, 0xe4, 0x15,
+  0x44, 0x36, 0x67, 0xc0, 0x60, 0x30, 0xe1, 0xc9, 0x90, 0x71, 0x50, 0x9c, 0xe7, 0xe0, 0xdf, 0x59,
+  0x96, 0xa7, 0xec, 0xf3, 0xbf, 0xc1, 0x16, 0xca, 0xd1, 0xc8, 0x04, 0xe0, 0xd7, 0x82, 0x2c, 0xea,
+  0x4d, 0x49, 0x6f, 0xc0, 0x38, 0x03, 0x18, 0x78, 0xfb, 0x65, 0x04, 0x36, 0xb8, 0xdd, 0xbe, 0x3f,
+  0x8d, 0x63, 0xd7, 0x89, 0x50, 0xa0, 0x64, 0xe7, 0x2f, 0x1d, 0xcf, 0x07, 0x0f, 0x7e, 0x06, 0x8e,
+  0xda, 0xd5, 0xaa, 0x08, 0x26, 0xde, 0x43, 0xf5, 0x03, 0xe3, 0x1d, 0x84, 0x21, 0xc5, 0x5b, 0xaf,
+  0x22, 0x58, 0x9e, 0x84, 0xe7, 0xae, 0x33, 0x5d, 0x04, 0x09, 0x06, 0x0c, 0xac, 0x84, 0xf6, 0xa4,
+  0xb2, 0xeb, 0x18, 0x05, 0xb8, 0x6a, 0x09, 0x3c, 0x00, 0x17, 0x4e, 0x87, 0x4e, 0xd3, 0x39, 0x42,
+  0x9b, 0xd2, 0x0e, 0x43, 0xce, 0x42, 0x99, 0x12, 0x1d, 0xa1, 0x18, 0xfe, 0xfe, 0xbf, 0xc2, 0x14,
+  0x15, 0x94, 0xe8, 0xb0, 0xa4, 0xe4, 0x34, 0xf7, 0x3e, 0xe9, 0x78, 0x21, 0xf7, 0x3f, 0x16, 0xc8,
+  0xfb, 0x88, 0xed, 0x02, 0x9e, 0x2a, 0xb9, 0xe0, 0x1f, 0xb4, 0x0b, 0x53, 0x9f, 0xe7, 0x79, 0x9a,
+  0x7b, 0x65, 0xa3, 0xe9, 0x66, 0x2c, 0x88, 0x79, 0x0e, 0xea, 0xfa, 0x7d, 0x32, 0xff, 0xfc, 0x4b,
+  0x2c, 0xa2, 0x39, 0x38, 0x99, 0x1f, 0xa0, 0x65, 0x48, 0xe6, 0x77, 0xea, 0xcb, 0xd0, 0x6e, 0x64,
+  0x0d, 0xf8, 0x52, 0x90, 0xab, 0xff, 0x48, 0x72, 0x4d, 0xcb, 0x6d, 0xf9, 0x54, 0xb5, 0x37, 0x1a,
+  0xc2, 0x70, 0xd3, 0x16, 0x7a, 0x61, 0x3f, 0xe8, 0x28, 0xfc, 0xbd, 0xe7, 0x56, 0xd7, 0x9f, 0x82,
+  0x75, 0x45, 0x14, 0x69, 0xcc, 0x38, 0x5d, 0xe5, 0x53, 0x6e, 0x6c, 0xa1, 0x21, 0x04, 0x49, 0xa8,
+  0xa6, 0x02, 0xfc, 0x9a, 0x59, 0x63, 0x80, 0x07, 0x99, 0x79, 0x48, 0x4e, 0xac, 0x98, 0xbf, 0xa9,
+  0x8d, 0xd2, 0x01, 0xd9, 0xda, 0xc8, 0x61, 0x8d, 0xec, 0xa8, 0xe2, 0x0f, 0xe3, 0xb7, 0x6f, 0xfc,
+  0x2c, 0xc8, 0x0b, 0xee, 0x72, 0xd8, 0x91, 0x10, 0xfd, 0xd2, 0x9a, 0x7d, 0x11, 0xb3, 0xd6, 0xb8,
+  0x16, 0xcc, 0x4a, 0x68, 0x3b, 0x31, 0xdf, 0x7a, 0x2e, 0x4a, 0x08, 0xf6, 0xf1, 0x73, 0x50, 0xba,
+  0x40, 0x60, 0xc8, 0x00, 0x1b, 0x73, 0x19, 0xc4, 0xb0, 0x5f, 0x63, 0x3e, 0xc7, 0xfd, 0x2c, 0xd2,
+  0x57, 0xb0, 0x74, 0x31, 0x7f, 0xa8, 0xac, 0x98, 0xc7, 0x26, 0xc1, 0x4a, 0xb0, 0x02, 0xd2, 0xab,
+  0x09, 0x8f, 0xd8, 0x47, 0x1e, 0x82, 0xef, 0x7d, 0xba, 0x9a, 0xe5, 0xab, 0x19, 0xa6, 0x51, 0x94,
+  0x3f, 0x81, 0x65, 0x3d, 0x0d, 0xb6, 0x4c, 0x49, 0xec, 0x65, 0x22, 0x62, 0xff, 0x14, 0x22, 0x80,
+  0xf3, 0x68, 0xc9, 0xe5, 0x44, 0xee, 0x5e, 0xc8, 0xbb, 0xa7, 0x67, 0x7b, 0x1d, 0xf6, 0x89, 0x81,
+  0xf1, 0x19, 0xb2, 0xbd, 0x83, 0x6e, 0x18, 0xcd, 0x23, 0x01, 0x2d, 0x4b, 0xd8, 0x20, 0x0b, 0xab,
+  0x85, 0x28, 0x55, 0x58, 0x11, 0xc3, 0xd7, 0x61, 0x5d, 0xc0, 0x0a, 0x55, 0xd1, 0x92, 0xd9, 0xad,
+  0xe3, 0xb5, 0x02, 0x74, 0x42, 0x01, 0x64, 0xbb, 0xa2, 0x18, 0x73, 0xe5, 0xd7, 0xd4, 0x1e, 0x92,
+  0xfc, 0xf8, 0x12, 0xc4, 0xc5, 0xd9, 0x71, 0x62, 0x09, 0xc8, 0x1e, 0x42, 0xb4, 0xdd, 0xef, 0x7b,
+  0xf5, 0x78, 0x9f, 0x60, 0xcf, 0x0b, 0x1b, 0x1b, 0x32, 0x11, 0x2a, 0xf2, 0x9b, 0x08, 0x46, 0xbb,
+  0xe6, 0x0b, 0xd1, 0x16, 0xed, 0x31, 0x0c, 0x73, 0x95, 0x08, 0x4c, 0x4f, 0xeb, 0xa4, 0x00, 0x31,
+  0x5e, 0xa4, 0xb0, 0x4d, 0x5b, 0x39, 0xb1, 0x11, 0xfc, 0x1a, 0x56, 0x20, 0xc2, 0x71, 0xcb, 0xd8,
+  0x5c, 0xa1, 0x7b, 0xb3, 0x5a, 0x4e, 0x40, 0x07, 0xb1, 0xd9, 0xf2, 0x57, 0x44, 0xee, 0x3f, 0xfe,
+  0x7e, 0xb2, 0x57, 0x4b, 0x19, 0x11, 0x4f, 0x1c, 0xdd, 0xf0, 0x17, 0x11, 0x5a, 0xaf, 0xad, 0xbb,
+  0x90, 0xbf, 0x15, 0x8c, 0xaa, 0xcd, 0x5f, 0x06, 0x99, 0xd9, 0xb8, 0x85, 0x67, 0x6f, 0xcd, 0xd2,
+  0x1e, 0x89, 0x82, 0x42, 0xab, 0xa2, 0xa3, 0xdf, 0x4f, 0xe8, 0x1d, 0x12, 0x28, 0x60, 0xc3, 0xef,
+  0xeb, 0xe6, 0x22, 0xa3, 0xf6, 0x22, 0xab, 0x77, 0x2c, 0xb6, 0xd4, 0xb1, 0xd8, 0x36, 0x3a, 0xa8,
+  0x99, 0x5e, 0x6e, 0xa5, 0x2d, 0xf1, 0x0b, 0x94, 0x67, 0x49, 0x50, 0xd0, 0x61, 0x13, 0x63, 0x62,
+  0x03, 0xa0, 0x81, 0x75, 0x21, 0x88, 0x12, 0x85, 0xda, 0x57, 0x16, 0xd7, 0x21, 0x47, 0x33, 0xae,
+  0x58, 0x7e, 0x16, 0x25, 0xee, 0x64, 0x35, 0xb3, 0x72, 0x65, 0xa5, 0x0e, 0xdf, 0x83, 0x4f, 0xfd,
+  0xee, 0x69, 0x9e, 0x83, 0xfa, 0x61, 0xbf, 0x0e, 0xe8, 0x20, 0xe7, 0x67, 0x2a, 0x06, 0xa3, 0xc8,
+  0x7c, 0x85, 0xae, 0xf8, 0xe2, 0x12, 0xf4, 0x96, 0x95, 0xdb, 0x1d, 0x7b, 0x60, 0xb4, 0x6b, 0x2c,
+  0x18, 0x82, 0xae, 0x71, 0x1c, 0x68, 0xfd, 0x0a, 0x13, 0xa8, 0x01, 0x04, 0x16, 0xd2, 0x6e, 0x86,
+  0xe9, 0x3d, 0xdb, 0xa2, 0x4f, 0xa1, 0x73, 0x72, 0x01, 0xb3, 0xec, 0xef, 0x5f, 0x6a, 0xc3, 0xba,
+  0x66, 0xfb, 0x47, 0xe0, 0x04, 0xd8, 0x03, 0xd6, 0xdf, 0xfc, 0x76, 0xe6, 0x81, 0x52, 0x00, 0x12,
+  0xdd, 0x89, 0xf8, 0x1e, 0x02, 0xc2, 0x83, 0xef, 0x64, 0x8b, 0xb4, 0xd2, 0xd7, 0x8b, 0x28, 0xe6,
+  0xcc, 0x55, 0x83, 0xbe, 0xeb, 0x7b, 0x98, 0x78, 0x21, 0xed, 0x87, 0x20, 0x14, 0x70, 0x64, 0x73,
+  0xb1, 0x50, 0x76, 0x5b, 0x49, 0x6c, 0x2d, 0xcd, 0xab, 0xcd, 0xc5, 0x4d, 0x34, 0xbf, 0x09, 0xe6,
+  0x2d, 0x5c, 0x68, 0xf6, 0x2a, 0x08, 0xdc, 0x35, 0xe4, 0xc5, 0x07, 0x1e, 0xc4, 0xd8, 0x5d, 0x78,
+  0xdc, 0x67, 0xa0, 0x74, 0x3d, 0x76, 0x00, 0xa1, 0xf6, 0x1a, 0x7f, 0x4b, 0xec, 0x14, 0xe6, 0x2a,
+  0x0a, 0x80, 0x98, 0x6f, 0xb0, 0x34, 0x33, 0xb9, 0xe8, 0x5f, 0x52, 0x4a, 0xd8, 0xdf, 0x3c, 0xfa,
+  0x4e, 0x36, 0x0c, 0xca, 0x86, 0x03, 0xd9, 0x70, 0x70, 0x59, 0xaf, 0xd5, 0x88, 0x45, 0x9e, 0x5e,
+  0x4b, 0x07, 0x80, 0xce, 0x11, 0x62, 0xbc, 0x20, 0xd4, 0xca, 0xaa, 0x76, 0x88, 0x2e, 0xda, 0x30,
+  0xb5, 0x6c, 0xdf, 0xe8, 0x65, 0x03, 0xf2, 0x79, 0x0e, 0x7b, 0xa4, 0xc6, 0x0c, 0x76, 0x91, 0x5b,
+  0x81, 0x75, 0x12, 0xf2, 0x07, 0x74, 0x94, 0x7e, 0x17, 0x5b, 0xb9, 0xec, 0xf7, 0x4a, 0xd9, 0xd6,
+  0xa4, 0x59, 0x91, 0x92, 0x08, 0xe6, 0x8d, 0x75, 0x04, 0xc4, 0xb0, 0x8c, 0xe5, 0xcc, 0x90, 0x1a,
+  0xb9, 0x08, 0xf6, 0x80, 0x3d, 0x42, 0xa1, 0x69, 0x61, 0x83, 0xc0, 0xfa, 0x4a, 0xb0, 0x82, 0xe1,
+  0x00, 0xdd, 0x21, 0xdb, 0x50, 0x7c, 0x72, 0xd4, 0x81, 0x57, 0xd1, 0x1b, 0xa0, 0xb3, 0x01, 0x8c,
+  0xfb, 0xa9, 0xd9, 0x7a, 0x5b, 0x52, 0x99, 0x73, 0xd4, 0xb6, 0x4f, 0xb4, 0x6b, 0x61, 0xcf, 0x32,
+  0x88, 0x19, 0x04, 0x72, 0x0c, 0x7b, 0x2d, 0x43, 0x8e, 0x87, 0xf0, 0xb7, 0x83, 0x5b, 0x4f, 0xce,
+  0x38, 0x90, 0x5b, 0xcf, 0x26, 0xe2, 0xbb, 0x2a, 0x11, 0x80, 0xd0, 0x5f, 0x62, 0xca, 0x22, 0x80,
+  0xbd, 0x3a, 0x2d, 0xd4, 0xb9, 0xb9, 0xa3, 0x33, 0x64, 0x0d, 0x99, 0x49, 0x5a, 0x61, 0x93, 0xf9,
+  0xd9, 0xaa, 0x58, 0xb8, 0x00, 0x55, 0xae, 0xa8, 0x52, 0x3b, 0xe8, 0x6b, 0xb3, 0x8d, 0xa7, 0xab,
+  0x3c, 0x90, 0x86, 0xca, 0x36, 0xf5, 0x4b, 0x5d, 0xda, 0xc9, 0x53, 0xc8, 0x24, 0xb1, 0x4f, 0x96,
+  0x76, 0xec, 0x62, 0xce, 0x92, 0x1d, 0x1f, 0x41, 0x1b, 0x2c, 0x89, 0x5d, 0x04, 0x92, 0x70, 0x64,
+  0x46, 0x17, 0xf0, 0x17, 0x9c, 0xd6, 0x9e, 0x27, 0x4b, 0x3b, 0xbf, 0x29, 0x3b, 0xc0, 0x9f, 0x49,
+  0xfb, 0x8a, 0x53, 0x9d, 0xbd, 0x7b, 0x7b, 0xf2, 0xe2, 0xc7, 0xd7, 0x2f, 0xdf, 0xe0, 0x66, 0xff,
+  0xb6, 0xff, 0xbb, 0x47, 0x8f, 0x7f, 0x77, 0xd0, 0xef, 0x8f, 0x80, 0x1b, 0xf0, 0xed, 0xd7, 0xe0,
+  0xaa, 0x41, 0x07, 0xa2, 0xf0, 0x2c, 0x4b, 0x21, 0x50, 0xf2, 0x40, 0x2b, 0x58, 0x22, 0x32, 0x7f,
+  0x9a, 0x81, 0xdc, 0xc3, 0x00, 0xc2, 0x73, 0xf4, 0xfb, 0xdf, 0x67, 0x02, 0x1c, 0x43, 0x77, 0xcc,
+  0xaf, 0x28, 0xed, 0xb5, 0x78, 0x9c, 0xac, 0xa2, 0x38, 0x7c, 0xb7, 0x08, 0x0a, 0xfe, 0x3e, 0xbd,
+  0x2e, 0xdc, 0x0c, 0x9f, 0x8a, 0x8a, 0xd1, 0x96, 0x4d, 0x55, 0x9b, 0x0d, 0xb8, 0x23, 0x65, 0xb6,
+  0x81, 0x06, 0xc8, 0x0f, 0x7a, 0x4f, 0x57, 0x05, 0x24, 0xc6, 0x20, 0x97, 0x48, 0x30, 0x0c, 0x86,
+  0x79, 0x0c, 0x09, 0x03, 0xfb, 0x0b, 0x8f, 0xc4, 0x24, 0x80, 0x74, 0x8a, 0xb9, 0x44, 0x5f, 0x4f,
+  0x12, 0xe2, 0xb1, 0x9b, 0x15, 0xc6, 0x22, 0x40, 0xd9, 0x69, 0x00, 0x69, 0x01, 0x5b, 0x43, 0x50,
+  0xca, 0xa7, 0x0b, 0x88, 0xbf, 0x4b, 0x8d, 0xca, 0x02, 0xc8, 0x3e, 0xd0, 0xa1, 0xba, 0x99, 0x8f,
+  0x45, 0x8b, 0xfb, 0x2a, 0xf3, 0x26, 0xf3, 0xe3, 0x62, 0x63, 0x82, 0xe2, 0x2d, 0x85, 0xe3, 0x51,
+  0x46, 0xab, 0x80, 0x2b, 0x1d, 0xd2, 0x60, 0xe9, 0x76, 0x1c, 0x38, 0x2a, 0x67, 0x89, 0x83, 0x02,
+  0x77, 0xa7, 0x1b, 0xd1, 0x68, 0xc5, 0xaa, 0x32, 0x29, 0x5d, 0x30, 0x11, 0x06, 0x12, 0x1c, 0x0d,
+  0xc3, 0xd1, 0xc6, 0xd3, 0x98, 0x3e, 0xf0, 0x35, 0xd4, 0x67, 0x9c, 0xcd, 0xa8, 0xcd, 0xa5, 0xa5,
+  0x09, 0xba, 0xe7, 0xa1, 0x09, 0x1f, 0x90, 0x16, 0x4f, 0xfb, 0x25, 0xa0, 0x4f, 0x76, 0x2b, 0xce,
+  0x9f, 0x54, 0xe0, 0x66, 0x33, 0xdc, 0xcf, 0xae, 0xe2, 0xaf, 0x2c, 0x43, 0x00, 0x67, 0xc8, 0x02,
+  0x6e, 0xfb, 0xbd, 0xf8, 0xf3, 0xcf, 0xab, 0x99, 0x20, 0x8d, 0x7a, 0xb2, 0x57, 0xa2, 0x0d, 0x95,
+  0xfa, 0x36, 0xf0, 0x96, 0x7a, 0x2d, 0x51, 0x76, 0x49, 0x32, 0x38, 0xc9, 0xde, 0x7f, 0xff, 0xeb,
+  0xbf, 0xef, 0x95, 0x6e, 0x17, 0x22, 0x83, 0xb7, 0xc9, 0xd0, 0x8e, 0x13, 0x32, 0x5f, 0xbc, 0x4d,
+  0x34, 0xa3, 0x5e, 0x05, 0x70, 0x36, 0x03, 0x1a, 0xef, 0xab, 0x89, 0xc0, 0xd8, 0x22, 0xa8, 0x45,
+  0x2e, 0x91, 0x89, 0xd8, 0x59, 0x03, 0x21, 0x40, 0x35, 0x30, 0x2e, 0x20, 0x13, 0x07, 0x93, 0xe1,
+  0xa2, 0xe8, 0xbb, 0x28, 0xe4, 0xb6, 0x38, 0x04, 0x86, 0x61, 0xf0, 0x04, 0x30, 0x6d, 0x41, 0x8a,
+  0xed, 0xe6, 0x69, 0x43, 0xd5, 0x12, 0x06, 0x5a, 0xd9, 0xf5, 0xfc, 0xae, 0xd2, 0x0a, 0xfa, 0x81,
+  0xf1, 0x7a, 0xee, 0x18, 0xb3, 0x1e, 0x4c, 0x62, 0xfe, 0x43, 0x1e, 0x64, 0x5f, 0x1a, 0x75, 0xae,
+  0x01, 0xcd, 0x58, 0xc8, 0x5b, 0x73, 0xf1, 0x35, 0x63, 0x4f, 0x34, 0xa0, 0x19, 0xbb, 0x8e, 0xf8,
+  0xf5, 0x33, 0x91, 0x14, 0x3b, 0x8b, 0xa6, 0x94, 0x54, 0x5f, 0x60, 0x0e, 0xd0, 0x45, 0xd8, 0x4b,
+  0x53, 0x0d, 0xba, 0x8f, 0x3c, 0xc2, 0x7a, 0xdc, 0x37, 0xb4, 0xe3, 0x5b, 0x49, 0x4d, 0x7b, 0x82,
+  0x64, 0x7b, 0xf0, 0x82, 0x8b, 0x0f, 0x80, 0xd3, 0x5d, 0x42, 0xbc, 0x63, 0xa0, 0xa9, 0x80, 0x07,
+  0x2d, 0xb4, 0xc2, 0x0e, 0x21, 0x77, 0xaa, 0x76, 0xbc, 0x9c, 0xc2, 0x2f, 0xc4, 0x36, 0x86, 0x0c,
+  0x25, 0x2a, 0x20, 0x45, 0x44, 0x0f, 0x08, 0x89, 0x6e, 0xc2, 0x1d, 0x6d, 0xb5, 0x4b, 0xc2, 0x9a,
+  0x70, 0x13, 0x48, 0x2f, 0xaf, 0x1c, 0xdb, 0x8a, 0xf3, 0xb8, 0xe0, 0x5f, 0x3b, 0x8b, 0x3d, 0xfa,
+  0xce, 0x69, 0x2c, 0x72, 0x6e, 0x35, 0xfb, 0x5a, 0xe4, 0xcd, 0xe2, 0xc4, 0xc4, 0xd3, 0xc5, 0xb5,
+  0x96, 0xa4, 0x0d, 0x92, 0xfe, 0xab, 0x96, 0xda, 0x04, 0x2b, 0xa5, 0x38, 0xc1, 0x35, 0x7f, 0x2a,
+  0x20, 0xe9, 0x9a, 0x40, 0xde, 0x82, 0xa5, 0x2e, 0xb5, 0x66, 0x8e, 0xa7, 0x5d, 0x6b, 0x99, 0xe7,
+  0xaa, 0xd5, 0x3f, 0x79, 0xf1, 0xf4, 0xfd, 0xf9, 0x8f, 0x3f, 0xbc, 0x7c, 0x73, 0xfa, 0xf6, 0x07,
+  0x20, 0xf7, 0xbb, 0x6f, 0x1f, 0x95, 0x3e, 0x00, 0x4b, 0x21, 0x37, 0x3c, 0x9a, 0x0b, 0x5e, 0x90,
+  0xc5, 0x9d, 0xf1, 0x04, 0xcb, 0x58, 0xe8, 0x0a, 0xc0, 0xf0, 0x4e, 0xc0, 0xfa, 0x0e, 0x1e, 0xb1,
+  0xf3, 0x60, 0x0e, 0x0b, 0x77, 0x8f, 0x06, 0x7c, 0xe0, 0x79, 0x1c, 0x40, 0x4a, 0x07, 0x86, 0x9a,
+  0x8d, 0x23, 0x81, 0x85, 0xe2, 0x21, 0x38, 0xef, 0x84, 0x6f, 0xc0, 0x6f, 0x9f, 0xac, 0x72, 0x88,
+  0x87, 0x99, 0xcc, 0xb9, 0xc7, 0xfc, 0x27, 0xaf, 0xc3, 0x20, 0x3a, 0x02, 0xbf, 0x7e, 0xe1, 0xfb,
+  0xfe, 0x65, 0x59, 0xe4, 0x7d, 0xf1, 0x72, 0x7c, 0xfe, 0xe3, 0x1f, 0xcf, 0xfe, 0x8c, 0xa2, 0xc3,
+  0x12, 0xf0, 0x14, 0x32, 0x36, 0x15, 0x32, 0x39, 0xd5, 0x10, 0x36, 0x4e, 0x83, 0x50, 0x85, 0xc8,
+  0x27, 0x58, 0xe2, 0xb0, 0xc2, 0x40, 0x91, 0x6f, 0x2b, 0xeb, 0x48, 0x5b, 0x04, 0x30, 0x5a, 0x49,
+  0x2d, 0x18, 0xe4, 0x02, 0xb0, 0x8c, 0x61, 0x38, 0x70, 0x80, 0x72, 0x7b, 0x09, 0xa6, 0xc6, 0xd5,
+  0xd3, 0x7b, 0x96, 0xdf, 0x97, 0x5e, 0x77, 0x8a, 0x46, 0x51, 0x6c, 0x33, 0x9e, 0xce, 0xb0, 0xb0,
+  0x05, 0x3c, 0x49, 0xed, 0x4c, 0x28, 0x9d, 0x71, 0xb0, 0x97, 0x62, 0x71, 0x3f, 0x2a, 0x64, 0x4c,
+  0x3e, 0xf5, 0x91, 0x3f, 0x0f, 0x8d, 0xd3, 0x14, 0x0c, 0x93, 0x3c, 0x12, 0x34, 0xca, 0x46, 0x15,
+  0x08, 0xe6, 0xf2, 0x7a, 0x7c, 0x42, 0xb3, 0x55, 0x81, 0x6b, 0x5b, 0x26, 0x58, 0xf3, 0x0a, 0xdf,
+  0xd3, 0xdd, 0x8c, 0xd7, 0xb8, 0x2c, 0x6a, 0x5c, 0x76, 0xa4, 0x44, 0x0a, 0xca, 0xd2, 0xa3, 0x19,
+  0xd0, 0xec, 0x79, 0x5f, 0xa6, 0xb1, 0x86, 0x34, 0xe7, 0xcb, 0x74, 0xcd, 0xab, 0xd2, 0xdb, 0x45,
+  0x3b, 0x55, 0xbd, 0xac, 0xbc, 0x86, 0xec, 0x4c, 0xdd, 0x4a, 0x94, 0xb5, 0x31, 0x9d, 0xd7, 0x4d,
+  0xa2, 0xe4, 0x09, 0x96, 0x8a, 0x08, 0x1a, 0x13, 0x75, 0x59, 0xd2, 0x62, 0xa6, 0xa6, 0xc5, 0xee,
+  0x28, 0x6a, 0x55, 0xea, 0x54, 0xf7, 0x73, 0x3f, 0xbd, 0x6a, 0xaf, 0x52, 0x35, 0xa2, 0x75, 0x1d,
+  0xa9, 0xe3, 0xd4, 0xb9, 0x2f, 0x8b, 0x31, 0x5e, 0x5b, 0xb1, 0x89, 0xd4, 0x0b, 0x82, 0x94, 0x23,
+  0x00, 0x53, 0x45, 0x3b, 0x54, 0x28, 0xd7, 0xf9, 0x53, 0x57, 0xf1, 0xda, 0x95, 0xda, 0x6f, 0x57,
+  0xaf, 0xca, 0x52, 0x5b, 0x80, 0xda, 0xf2, 0x6c, 0x35, 0x9b, 0xc1, 0x1e, 0xf7, 0x6a, 0xe4, 0x63,
+  0x5e, 0xf7, 0xa9, 0x51, 0xf0, 0x2a, 0xf7, 0x14, 0x4d, 0x6a, 0x8e, 0x0e, 0xe8, 0x67, 0xa8, 0x13,
+  0x6c, 0xe8, 0x2c, 0xf7, 0x58, 0x6b, 0x42, 0xa9, 0x83, 0x65, 0x63, 0x17, 0x2c, 0x0b, 0xa1, 0xb6,
+  0xf4, 0x59, 0x5e, 0xe0, 0xf6, 0x7f, 0x85, 0xe7, 0xdc, 0x43, 0x36, 0x0f, 0x92, 0x1b, 0x78, 0x7b,
+  0x2e, 0x0d, 0xc1, 0x08, 0x02, 0xc1, 0x04, 0x56, 0x82, 0x02, 0xb4, 0x04, 0xc2, 0x30, 0x36, 0x0e,
+  0x96, 0x59, 0x0c, 0x00, 0xc1, 0x84, 0x61, 0x85, 0x47, 0x32, 0xbd, 0x6b, 0xfd, 0x6b, 0x69, 0x1b,
+  0xad, 0x29, 0x88, 0xb0, 0xb9, 0xad, 0x4d, 0x48, 0x7f, 0x9f, 0x80, 0x5a, 0x77, 0x4c, 0x5d, 0xb3,
+  0xb0, 0xcc, 0x5f, 0x50, 0x2d, 0x96, 0x82, 0xe4, 0x29, 0x8f, 0x62, 0xb7, 0x62, 0xeb, 0x7a, 0xd2,
+  0xd6, 0x51, 0xcd, 0xf6, 0x81, 0x88, 0x78, 0x7e, 0x94, 0x07, 0xd7, 0x0f, 0x96, 0xc1, 0x86, 0x6a,
+  0xd5, 0xc5, 0xd1, 0xb7, 0xfd, 0xbe, 0x53, 0x5f, 0x0e, 0x08, 0x1c, 0x6a, 0xfa, 0x04, 0x2d, 0xd2,
+  0x16, 0x94, 0x71, 0x64, 0xab, 0x6e, 0x35, 0xf6, 0x2c, 0x62, 0x6a, 0x53, 0x25, 0xad, 0x15, 0x80,
+  0x16, 0x57, 0xae, 0xba, 0x28, 0x6a, 0x59, 0x76, 0xf3, 0xac, 0x6d, 0x2b, 0xf1, 0x4d, 0xb2, 0x22,
+  0xe2, 0xee, 0x62, 0xa3, 0xc2, 0x44, 0xa9, 0x4b, 0xe0, 0xc5, 0xcb, 0xc6, 0x43, 0x1b, 0xd3, 0xbd,
+  0x3a, 0x6f, 0xa0, 0x23, 0x8a, 0x02, 0xba, 0x10, 0x81, 0x3e, 0x23, 0xe6, 0x73, 0xc1, 0xdc, 0xf7,
+  0x1c, 0xac, 0x4d, 0x4f, 0x16, 0xd9, 0xbc, 0x21, 0x0b, 0x62, 0x54, 0x0c, 0x08, 0xc8, 0xaf, 0x79,
+  0x3e, 0x53, 0xf1, 0xf8, 0xaf, 0x32, 0x26, 0x3b, 0xf8, 0x36, 0x09, 0xda, 0xad, 0x65, 0xec, 0x51,
+  0x76, 0x78, 0x00, 0x41, 0x84, 0xe3, 0x8b, 0x3f, 0x4d, 0x13, 0xb0, 0x66, 0xae, 0x16, 0x6c, 0x39,
+  0xca, 0x8a, 0xd6, 0x09, 0x4e, 0x05, 0xe9, 0x4f, 0xe8, 0xed, 0xc2, 0x6e, 0x82, 0xb8, 0xfd, 0x12,
+  0x8b, 0x36, 0x43, 0xd6, 0x2f, 0x7d, 0x83, 0x9c, 0x86, 0xa0, 0x66, 0x51, 0x0c, 0xc2, 0xaf, 0xd4,
+  0x9f, 0x34, 0xbd, 0x58, 0x6f, 0x62, 0xc7, 0x72, 0x9a, 0x6e, 0xc5, 0xe3, 0x8e, 0xac, 0x8d, 0xd7,
+  0xd0, 0x11, 0xbd, 0xcb, 0xf5, 0x4a, 0xe8, 0xcd, 0x4c, 0xb3, 0xde, 0xd6, 0x1d, 0x94, 0x51, 0x17,
+  0x6b, 0x07, 0x97, 0x1b, 0x6f, 0x1a, 0xf3, 0x20, 0x87, 0x70, 0xd3, 0xda, 0x74, 0xaa, 0x48, 0x00,
+  0x21, 0x1c, 0xd0, 0x9e, 0x63, 0x68, 0x08, 0x29, 0x5b, 0xcd, 0xd2, 0x43, 0x9f, 0x5c, 0x11, 0xea,
+  0xac, 0xc3, 0xee, 0xb2, 0xf2, 0x21, 0xec, 0x24, 0x3a, 0xa1, 0xda, 0x74, 0xb6, 0x1d, 0x01, 0x84,
+  0x4f, 0xe3, 0xa2, 0x56, 0x7d, 0xb0, 0x83, 0xcd, 0x69, 0x8e, 0x47, 0xbd, 0x2a, 0x54, 0x7d, 0x33,
+  0x06, 0xc3, 0x2b, 0x44, 0x36, 0xec, 0xf5, 0xae, 0xaf, 0xaf, 0xfd, 0xeb, 0x6f, 0xfc, 0x34, 0x9f,
+  0xf7, 0x20, 0x31, 0xed, 0xf7, 0x60, 0x76, 0xa7, 0xe3, 0xe0, 0x09, 0xac, 0xb6, 0xa3, 0x02, 0x3d,
+  0x9a, 0x15, 0xef, 0x6c, 0x20, 0x3a, 0xda, 0xec, 0xe8, 0xdb, 0x42, 0xdf, 0xb6, 0xec, 0x6b, 0xbd,
+  0x62, 0xd0, 0x1c, 0x04, 0x8b, 0x1a, 0xc3, 0x38, 0x07, 0x6c, 0x69, 0x0e, 0xa0, 0x27, 0x69, 0x6c,
+  0x8c, 0x78, 0x03, 0x16, 0xd0, 0x75, 0x8b, 0xe8, 0x06, 0x8f, 0x8f, 0x9c, 0xc1, 0x81, 0x63, 0xd9,
+  0x2d, 0xc5, 0xbf, 0x11, 0x6c, 0x7d, 0x2c, 0x1d, 0x50, 0xe3, 0x51, 0x5e, 0x5c, 0x54, 0x1c, 0x30,
+  0x0a, 0x3c, 0xc8, 0x32, 0x9e, 0x84, 0x72, 0x01, 0x44, 0xb5, 0xa2, 0x25, 0x46, 0xad, 0xb2, 0x7f,
+  0x05, 0x29, 0xb0, 0xbb, 0x19, 0x74, 0xb6, 0x83, 0xce, 0xe6, 0xa0, 0xb3, 0x3d, 0xe8, 0x80, 0x83,
+  0x4f, 0xaf, 0x78, 0xe7, 0x3a, 0x0a, 0xeb, 0x65, 0xa0, 0xf8, 0x9f, 0x5f, 0x88, 0x18, 0x66, 0xd1,
+  0x4c, 0xc6, 0xf5, 0x85, 0x18, 0xe0, 0x4a, 0x0c, 0x76, 0xf4, 0x6e, 0xb1, 0x77, 0xbb, 0xab, 0x77,
+  0x73, 0x80, 0x63, 0x0f, 0x76, 0x8d, 0xc5, 0xde, 0xed, 0xae, 0x5e, 0xc9, 0x28, 0x1e, 0x8d, 0xd3,
+  0xc3, 0x9d, 0x50, 0x5d, 0x12, 0x07, 0xc0, 0xd2, 0x2f, 0x9a, 0xbc, 0x5d, 0x14, 0xa5, 0x59, 0x30,
+  0x8d, 0x04, 0x2a, 0x90, 0xd3, 0xf7, 0x1f, 0x6b, 0x9e, 0xeb, 0x6b, 0x13, 0x57, 0xd7, 0x26, 0x6e,
+  0x5f, 0x9b, 0x77, 0xe0, 0x8d, 0xdc, 0xf0, 0x8e, 0x15, 0xc9, 0xfe, 0xf9, 0x15, 0xc9, 0x00, 0xb7,
+  0xa6, 0x2e, 0xab, 0xf1, 0x10, 0x02, 0xf5, 0xe1, 0x8e, 0x3e, 0xad, 0xe5, 0x94, 0xaa, 0xec, 0x80,
+  0x69, 0x97, 0x6c, 0xf6, 0x95, 0x92, 0x3d, 0xd8, 0x21, 0xb3, 0xac, 0x2a, 0xb3, 0x6c, 0xd4, 0x1e,
+  0x31, 0x52, 0x21, 0xa9, 0x70, 0x77, 0x06, 0x8a, 0xaa, 0xc0, 0x82, 0x87, 0x96, 0x4f, 0xc8, 0xef,
+  0xa3, 0x82, 0xfd, 0xca, 0x30, 0xb1, 0xed, 0xec, 0xb3, 0x49, 0x0e, 0x58, 0x01, 0x08, 0xef, 0x28,
+  0x03, 0x2f, 0x8b, 0x5a, 0xd5, 0xb2, 0x2a, 0xf4, 0xbc, 0x97, 0x6e, 0xa1, 0xbd, 0x06, 0x66, 0x45,
+  0x33, 0x25, 0xb0, 0x55, 0xa1, 0xb5, 0x6c, 0x44, 0x99, 0x53, 0x46, 0x09, 0xe4, 0x7f, 0x2f, 0xce,
+  0x5f, 0xbf, 0x02, 0xa4, 0x7b, 0x87, 0x61, 0xb4, 0x66, 0x64, 0x2f, 0x8e, 0x9c, 0x25, 0x08, 0x3d,
+  0x74, 0x8e, 0xff, 0x88, 0x35, 0x2f, 0xba, 0x9a, 0x43, 0x73, 0x24, 0x2c, 0x5a, 0xea, 0x5c, 0xec,
+  0xb0, 0x07, 0xe0, 0xc7, 0x7b, 0x55, 0x5f, 0x51, 0x89, 0x25, 0xa8, 0xd0, 0x24, 0x96, 0x31, 0xe1,
+  0xa6, 0x39, 0x8f, 0x0f, 0x05, 0x46, 0xb1, 0xf0, 0x93, 0xe3, 0xe3, 0xf1, 0x59, 0x94, 0x1c, 0xf6,
+  0xe0, 0x17, 0x9f, 0x9f, 0xae, 0x8a, 0xf2, 0x99, 0x6a, 0x6c, 0xe5, 0x1b, 0x96, 0x5c, 0x98, 0x0d,
+  0x4a, 0x0d, 0x36, 0xfc, 0x78, 0xba, 0xb8, 0xe6, 0x10, 0x06, 0xc8, 0x86, 0x1e, 0x62, 0xef, 0xe9,
+  0x99, 0xf0, 0xa4, 0x5a, 0x93, 0x69, 0xc4, 0xd2, 0x48, 0x8f, 0x4d, 0x38, 0x4f, 0x24, 0xef, 0x13,
+  0xcd, 0x48, 0x65, 0x78, 0xbc, 0x47, 0x51, 0xba, 0xac, 0x85, 0x61, 0x9d, 0x06, 0x70, 0x87, 0x76,
+  0x87, 0x2c, 0x83, 0xb5, 0xf4, 0xe8, 0x4a, 0x56, 0x4b, 0x97, 0xac, 0x52, 0xed, 0xea, 0x98, 0xcd,
+  0xda, 0x7a, 0xa8, 0xba, 0x64, 0x3a, 0x90, 0xcd, 0x3d, 0xdb, 0x2f, 0xdb, 0xa4, 0xf7, 0x24, 0xdf,
+  0xf0, 0x4b, 0x72, 0xb7, 0xf9, 0x6f, 0x2c, 0x3c, 0x8e, 0x2a, 0xf5, 0x11, 0x17, 0x6d, 0xfc, 0xe1,
+  0xf7, 0x3f, 0xbe, 0x19, 0x53, 0x9e, 0xbc, 0xdb, 0x28, 0x54, 0x53, 0x66, 0x68, 0x39, 0x8b, 0xb1,
+  0x30, 0xde, 0x61, 0x01, 0x6c, 0xda, 0x9a, 0xee, 0xf2, 0xbb, 0x2c, 0x8f, 0x9c, 0xad, 0x83, 0x85,
+  0x76, 0x7d, 0x83, 0x01, 0xb3, 0x79, 0x1c, 0x77, 0x85, 0x15, 0x81, 0x12, 0x9f, 0x51, 0x60, 0x5e,
+  0x35, 0x0e, 0x57, 0x6a, 0xd2, 0x8b, 0xab, 0xcb, 0x3b, 0x7d, 0x1c, 0xaf, 0xda, 0x04, 0x6e, 0xa7,
+  0x23, 0x3c, 0xa7, 0x0a, 0xc4, 0x4b, 0xd8, 0x84, 0x1b, 0xaa, 0x09, 0xc7, 0x10, 0x30, 0x5d, 0x44,
+  0x97, 0x58, 0x81, 0x5d, 0x33, 0x17, 0xdf, 0x18, 0x68, 0x3d, 0x00, 0x45, 0x73, 0x40, 0xc8, 0xf0,
+  0x04, 0x0e, 0x42, 0x7b, 0x8a, 0x5b, 0xad, 0xc2, 0x01, 0xc4, 0xa0, 0xcf, 0xa8, 0xbe, 0x8e, 0x03,
+  0x3a, 0x6c, 0xdd, 0x81, 0xb6, 0x0e, 0x5b, 0x44, 0x8d, 0xe0, 0x28, 0x4e, 0x21, 0xfc, 0x95, 0xed,
+  0xd5, 0x6a, 0xc2, 0x32, 0xa2, 0x1a, 0x32, 0xf4, 0xef, 0x63, 0x3f, 0x3b, 0x3e, 0x66, 0x83, 0x91,
+  0x15, 0x52, 0x13, 0x5d, 0x00, 0x74, 0x09, 0xe3, 0xd7, 0xcd, 0xa8, 0x19, 0xc6, 0x1d, 0x11, 0x8e,
+  0x7d, 0x33, 0x4c, 0xc7, 0xaf, 0x65, 0x15, 0xca, 0x1e, 0xb0, 0x88, 0xe4, 0x80, 0x2a, 0xf0, 0x6d,
+  0xc5, 0xe1, 0xa4, 0x2d, 0xe6, 0x6a, 0xe0, 0xae, 0x1b, 0x56, 0xd3, 0x3a, 0x5f, 0x58, 0xd3, 0xf1,
+  0xad, 0x47, 0x35, 0x52, 0x5b, 0xce, 0xaf, 0xa3, 0xa4, 0xf7, 0x3a, 0xd8, 0x74, 0x4f, 0xf9, 0x4d,
+  0xb4, 0x8c, 0xe4, 0x6d, 0x1c, 0xbc, 0x9b, 0xf3, 0x2e, 0xda, 0x00, 0x79, 0x59, 0x10, 0xe3, 0xa9,
+  0xf8, 0x47, 0xce, 0xc6, 0xf4, 0xa8, 0x96, 0xa5, 0xc3, 0xae, 0x62, 0xb0, 0x44, 0xf4, 0x28, 0xd1,
+  0xcc, 0xf3, 0xcf, 0xff, 0xf5, 0xf9, 0x6f, 0xb8, 0x62, 0x30, 0x19, 0x8b, 0xb9, 0xb8, 0xc1, 0xe7,
+  0x77, 0xab, 0xe4, 0x4a, 0xf8, 0x6c, 0x1c, 0xf1, 0x05, 0xae, 0x56, 0x41, 0x87, 0x0d, 0x98, 0x1f,
+  0xc8, 0x1e, 0xde, 0x61, 0xb4, 0x8c, 0x90, 0xc3, 0xe2, 0x5a, 0x4a, 0x4c, 0x8f, 0x54, 0x9f, 0xa1,
+  0x82, 0x4d, 0xf8, 0x1c, 0xac, 0xf1, 0x0d, 0xac, 0x1f, 0x9f, 0x07, 0xb1, 0x3c, 0xb1, 0x88, 0x20,
+  0xf9, 0x28, 0xb3, 0x50, 0xb0, 0x82, 0x2a, 0x53, 0x05, 0x35, 0xc1, 0x8b, 0x09, 0x7e, 0xc5, 0x19,
+  0xf3, 0x69, 0x04, 0xa9, 0x09, 0x0f, 0xc9, 0x23, 0x6f, 0x0a, 0xba, 0x44, 0x0a, 0xff, 0x6e, 0x9f,
+  0xcb, 0x6b, 0x2c, 0x66, 0x5f, 0x84, 0xea, 0xfc, 0xb4, 0xcc, 0x54, 0x53, 0x34, 0x96, 0xdd, 0x01,
+  0xd0, 0xf9, 0x5c, 0x1e, 0xbd, 0x45, 0x74, 0xf3, 0x4d, 0x3e, 0x05, 0x1b, 0xf5, 0xf4, 0x4a, 0xfe,
+  0x66, 0x39, 0x5f, 0x13, 0xf8, 0x48, 0xda, 0xdb, 0x92, 0x00, 0x0e, 0xfa, 0xeb, 0xd6, 0x54, 0x0b,
+  0x55, 0x27, 0xa2, 0x5c, 0x12, 0x87, 0x35, 0xf5, 0x26, 0x94, 0xa7, 0x4c, 0x2e, 0x21, 0x3d, 0x64,
+  0x74, 0x63, 0xf7, 0x35, 0xdd, 0x36, 0x7c, 0x45, 0x57, 0x76, 0x61, 0xbd, 0x37, 0x05, 0xec, 0x07,
+  0xca, 0x6a, 0x65, 0xe1, 0x62, 0xe0, 0x22, 0x47, 0x78, 0xdc, 0x4e, 0x1d, 0x9e, 0x95, 0x4e, 0x29,
+  0xd2, 0xa2, 0xba, 0x52, 0x55, 0xe9, 0x9c, 0xc5, 0x38, 0x65, 0x6d, 0x6b, 0x13, 0xed, 0xcf, 0x4b,
+  0x5c, 0xf2, 0x1d, 0xa5, 0x70, 0x28, 0x45, 0xf0, 0x44, 0xca, 0x64, 0x48, 0x6f, 0x77, 0x83, 0xc1,
+  0xcf, 0x90, 0xa0, 0x6b, 0x60, 0xaf, 0xaa, 0x39, 0x6f, 0x69, 0x6e, 0x22, 0x3a, 0xe6, 0x84, 0x9f,
+  0x43, 0xb6, 0xd1, 0x9e, 0x13, 0x5e, 0xf7, 0xf7, 0xbd, 0xd6, 0x9a, 0x9f, 0x75, 0x46, 0x26, 0x45,
+  0x63, 0x6f, 0xd3, 0x29, 0xc9, 0x1a, 0x16, 0xb4, 0x29, 0x6a, 0xea, 0x86, 0x95, 0x06, 0xcb, 0xd2,
+  0x6f, 0x4f, 0xea, 0x95, 0x60, 0xda, 0xd2, 0x78, 0xa9, 0x22, 0x53, 0xd3, 0x45, 0x9a, 0xa2, 0xd4,
+  0x44, 0xe9, 0x08, 0x29, 0x48, 0x34, 0xb2, 0xc6, 0x24, 0x22, 0x4a, 0x56, 0xbc, 0x6e, 0x0f, 0xaa,
+  0x70, 0x48, 0x96, 0x5a, 0x4b, 0x34, 0x2d, 0xf4, 0x04, 0x68, 0x61, 0xc5, 0x3f, 0x95, 0xf8, 0x47,
+  0x66, 0xac, 0x05, 0x7d, 0xac, 0xa1, 0x83, 0x8d, 0x82, 0x96, 0x64, 0x8c, 0x2a, 0xc6, 0xa4, 0xc9,
+  0xb6, 0x66, 0xb9, 0xc2, 0x6e, 0xc5, 0xf2, 0x84, 0xfe, 0xc7, 0x14, 0xcb, 0x0f, 0xce, 0xce, 0x80,
+  0x89, 0x8e, 0x1d, 0x5c, 0x4a, 0xbc, 0xcb, 0xad, 0x65, 0x52, 0x52, 0x2b, 0x24, 0xca, 0x77, 0x45,
+  0x43, 0x65, 0x4e, 0x39, 0x80, 0x3d, 0x75, 0x00, 0x7f, 0x1d, 0x19, 0xf5, 0xa8, 0x38, 0xa7, 0xc0,
+  0xaf, 0x3a, 0x12, 0xac, 0x2f, 0xcc, 0x3e, 0xff, 0x32, 0x9f, 0x04, 0xb9, 0x8f, 0x01, 0xad, 0xe3,
+  0x7d, 0x21, 0xf0, 0x91, 0x01, 0x2a, 0x9e, 0xa6, 0xda, 0xc7, 0x6e, 0x1c, 0x6f, 0x2d, 0xe2, 0x61,
+  0xfc, 0x81, 0xd5, 0x9a, 0x05, 0x21, 0x2e, 0xc4, 0x63, 0xdc, 0xd2, 0x41, 0xf8, 0x1e, 0x0f, 0x4d,
+  0xe5, 0xe3, 0xb9, 0x79, 0x7c, 0x86, 0x83, 0xec, 0x31, 0x71, 0x2a, 0xb0, 0xaa, 0x2e, 0xa7, 0xe9,
+  0x4a, 0x1c, 0xf4, 0xf3, 0xde, 0x00, 0x89, 0x14, 0x43, 0x7e, 0x44, 0xd4, 0x61, 0x93, 0x54, 0x88,
+  0x14, 0xcf, 0x80, 0x15, 0x0d, 0x04, 0xfb, 0x4c, 0x59, 0x0e, 0x30, 0x83, 0x94, 0xfa, 0xa3, 0x75,
+  0xa4, 0xba, 0x9b, 0x28, 0x4a, 0x07, 0x37, 0x2c, 0x4d, 0x5d, 0x06, 0x7f, 0x9f, 0x45, 0xc9, 0xe7,
+  0x9f, 0xf3, 0x62, 0x85, 0x15, 0x35, 0xac, 0x5b, 0x0a, 0xf6, 0x9c, 0xaa, 0x13, 0xc5, 0x74, 0x01,
+  0x16, 0x7a, 0xc6, 0xcb, 0xb9, 0xc1, 0xea, 0x9e, 0xeb, 0x4b, 0x6a, 0xb2, 0x6a, 0x6d, 0x2f, 0xc0,
+  0x68, 0xe7, 0xc6, 0xb3, 0xa0, 0x5a, 0xb6, 0x1e, 0x61, 0x45, 0x95, 0x3b, 0xd2, 0xb5, 0x48, 0x2a,
+  0xa6, 0x44, 0x58, 0x3e, 0xf1, 0x30, 0x1d, 0xe8, 0xd7, 0xcf, 0xf9, 0x97, 0xc1, 0x86, 0xe8, 0x90,
+  0x23, 0xe9, 0x5f, 0xbb, 0xec, 0x62, 0x84, 0xb5, 0x8c, 0x12, 0x02, 0x94, 0x03, 0x8e, 0xab, 0xc7,
+  0x17, 0x4f, 0x98, 0x2b, 0xdb, 0xab, 0x45, 0x16, 0x3c, 0x7c, 0x94, 0x88, 0xfb, 0x16, 0x26, 0xaa,
+  0x63, 0x50, 0xbd, 0xb1, 0x8c, 0x06, 0x08, 0xa8, 0x23, 0xe7, 0xe8, 0xa0, 0xed, 0xb6, 0x09, 0x51,
+  0xd2, 0x80, 0x45, 0x90, 0x7e, 0xac, 0x50, 0x7e, 0x86, 0xad, 0x41, 0x3e, 0x58, 0xed, 0xd4, 0x0b,
+  0xb0, 0xf8, 0xfc, 0x73, 0x8c, 0x87, 0xd5, 0x09, 0x5d, 0x72, 0x64, 0xc1, 0x12, 0xbc, 0x4f, 0x72,
+  0x05, 0xaf, 0xef, 0x83, 0x24, 0x2c, 0x35, 0x5d, 0x4e, 0x7f, 0xdc, 0xd8, 0x64, 0xd8, 0xdc, 0xed,
+  0x8e, 0x6a, 0x3b, 0x52, 0xb2, 0x75, 0x78, 0x24, 0x69, 0xab, 0x0e, 0xd1, 0xb2, 0x93, 0xa2, 0xd9,
+  0xaf, 0xd6, 0x97, 0x6a, 0x72, 0x16, 0x05, 0x78, 0xec, 0xa4, 0x94, 0x5f, 0x57, 0x0e, 0x1a, 0x99,
+  0x0d, 0x91, 0xd4, 0xea, 0x60, 0x5d, 0x49, 0x91, 0xa5, 0xad, 0x05, 0x1e, 0x48, 0x55, 0x54, 0x26,
+  0xb1, 0x8e, 0xb3, 0x37, 0xc5, 0xce, 0x2e, 0x8c, 0x99, 0x77, 0xf7, 0xae, 0x20, 0x02, 0xcc, 0x77,
+  0x77, 0xd3, 0x2a, 0xed, 0xee, 0x06, 0x36, 0x3e, 0x40, 0xe7, 0xcb, 0x64, 0x16, 0x25, 0x90, 0xa9,
+  0x77, 0x90, 0x3f, 0x6c, 0xe8, 0xea, 0x96, 0x51, 0xcd, 0x89, 0x7c, 0x94, 0xba, 0xfc, 0x11, 0x74,
+  0x39, 0x81, 0x9f, 0x36, 0xe7, 0x91, 0x2b, 0x51, 0x5c, 0xc8, 0xa5, 0xda, 0x67, 0x1f, 0x2f, 0xed,
+  0xa2, 0x21, 0xdd, 0xc2, 0x21, 0xe7, 0x02, 0x73, 0x49, 0xd5, 0xb1, 0x20, 0x95, 0x16, 0x55, 0xca,
+  0x8c, 0xe2, 0x03, 0x5d, 0xe7, 0xd1, 0x5b, 0xc2, 0x17, 0x27, 0xf6, 0x66, 0xd0, 0xd7, 0x01, 0x6a,
+  0x40, 0x45, 0xd6, 0x02, 0xb5, 0xd8, 0xd6, 0xa0, 0xf0, 0x10, 0x5b, 0x41, 0x95, 0xf7, 0xdc, 0x70,
+  0x9d, 0x2e, 0x3e, 0xe2, 0x26, 0x14, 0x65, 0x1d, 0x19, 0x3c, 0x20, 0xb5, 0x90, 0x21, 0xda, 0x67,
+  0xae, 0x28, 0x75, 0x00, 0x63, 0x40, 0xa5, 0x1d, 0x0f, 0xa5, 0xdd, 0x1a, 0x59, 0x27, 0xf0, 0x6a,
+  0x18, 0x72, 0xa0, 0x9b, 0xe5, 0x82, 0xc9, 0x76, 0x49, 0xf5, 0xbe, 0xa4, 0x4b, 0x03, 0xc8, 0x25,
+  0xb3, 0x01, 0xba, 0x55, 0x00, 0xb5, 0x68, 0x52, 0x86, 0xe0, 0x3f, 0xf0, 0xbd, 0x43, 0x73, 0x74,
+  0xcc, 0xe0, 0x52, 0x82, 0x6a, 0x45, 0x4b, 0x89, 0xe3, 0xbb, 0x86, 0x2e, 0x69, 0xf1, 0x5a, 0x36,
+  0xce, 0x07, 0xc9, 0xe2, 0x07, 0x8c, 0x97, 0xfc, 0xc7, 0xb5, 0xbd, 0x83, 0xed, 0xdd, 0x23, 0xec,
+  0xa8, 0xcc, 0xb3, 0x6f, 0x35, 0x99, 0xdd, 0xb3, 0x36, 0x9b, 0x47, 0x23, 0xad, 0x07, 0x75, 0x1b,
+  0x88, 0xb5, 0xe8, 0x02, 0x67, 0xeb, 0x21, 0xc5, 0xd7, 0x8b, 0xbd, 0x1e, 0x84, 0xe9, 0x18, 0xae,
+  0x15, 0x2d, 0x7a, 0x10, 0xc0, 0x3a, 0xf0, 0xfb, 0x80, 0x16, 0xa1, 0x14, 0x71, 0x88, 0x9c, 0x68,
+  0xc6, 0x0b, 0x79, 0xae, 0xf2, 0x2d, 0x5d, 0x04, 0xaf, 0x86, 0x56, 0x32, 0x2d, 0x74, 0xf0, 0xd3,
+  0x35, 0xaa, 0x9b, 0x6c, 0x86, 0x68, 0xfc, 0xb6, 0xf4, 0x2f, 0xb9, 0xae, 0xa1, 0xfc, 0xe9, 0x28,
+  0xb7, 0x34, 0x54, 0xbf, 0x58, 0x18, 0xa5, 0xc2, 0x25, 0xc4, 0x9f, 0x93, 0xb9, 0xa3, 0x8f, 0x95,
+  0xe5, 0xa1, 0x80, 0xa9, 0x46, 0x40, 0xd4, 0x41, 0x37, 0xfc, 0xdf, 0xcd, 0x82, 0x70, 0xc4, 0x9e,
+  0x7d, 0xfe, 0x19, 0x23, 0x82, 0x0e, 0x7d, 0x6c, 0x59, 0x44, 0xe0, 0xc6, 0x20, 0x4e, 0x57, 0xf7,
+  0x7a, 0x74, 0x60, 0x9f, 0x7f, 0xfe, 0x05, 0xd2, 0xe8, 0xa4, 0xa3, 0x91, 0x81, 0x2e, 0xa0, 0x3d,
+  0xbd, 0x59, 0x15, 0xc1, 0x12, 0xf2, 0x51, 0x79, 0xc4, 0x60, 0xee, 0xe5, 0x83, 0x5d, 0x2d, 0x6a,
+  0x31, 0x3a, 0xb6, 0xfd, 0x49, 0x45, 0xe9, 0xf8, 0xac, 0xbf, 0x6c, 0xe8, 0xcb, 0xd7, 0xb3, 0x24,
+  0x54, 0x31, 0x79, 0xc5, 0x2a, 0xc8, 0x8b, 0x93, 0xac, 0x90, 0x56, 0xa1, 0x68, 0xb3, 0x0a, 0x69,
+  0x52, 0x37, 0x0b, 0xc5, 0xa5, 0xbf, 0xb0, 0xa3, 0x33, 0x80, 0x78, 0xf0, 0x40, 0x11, 0x70, 0x68,
+  0x62, 0x47, 0x13, 0x39, 0x6a, 0xda, 0x60, 0x33, 0x16, 0x97, 0x6d, 0xd9, 0x9f, 0x0c, 0x85, 0x6c,
+  0x3c, 0x76, 0x10, 0x5a, 0x45, 0x54, 0xc8, 0x8c, 0x80, 0xc0, 0x3a, 0x12, 0xa5, 0x15, 0x91, 0x1a,
+  0x31, 0xb4, 0x25, 0x8e, 0x74, 0xd3, 0xb1, 0x86, 0x5f, 0x63, 0x6f, 0xc5, 0x9d, 0x90, 0x37, 0x6e,
+  0xdc, 0xd2, 0x43, 0x80, 0x53, 0x6b, 0x01, 0x4a, 0x79, 0x4e, 0xa4, 0x3c, 0x27, 0x78, 0x0b, 0x91,
+  0xf0, 0xe9, 0x90, 0x61, 0x82, 0x3b, 0xec, 0xa0, 0x29, 0xdd, 0xcd, 0x00, 0xeb, 0x66, 0x08, 0x7a,
+  0x31, 0xb9, 0xc4, 0x2a, 0xb0, 0xbd, 0xe3, 0x55, 0x3b, 0xe6, 0xcc, 0xd8, 0x37, 0xa0, 0x2b, 0x9c,
+  0xb6, 0xe4, 0x89, 0x0e, 0xed, 0xb9, 0x40, 0x76, 0x00, 0x72, 0x78, 0x54, 0xae, 0xf7, 0xbe, 0xbc,
+  0x9a, 0xd9, 0x14, 0xe1, 0xa9, 0x9f, 0xa5, 0x99, 0x1d, 0xc7, 0x97, 0x54, 0x94, 0x1f, 0xc0, 0xd8,
+  0x2b, 0x64, 0xab, 0xd3, 0xa6, 0x94, 0xab, 0xd1, 0xaa, 0xcd, 0x81, 0xdd, 0x76, 0x2a, 0x65, 0x88,
+  0x59, 0x9a, 0x4c, 0xcf, 0x06, 0x26, 0x37, 0x93, 0xfb, 0xd6, 0x79, 0xa1, 0xbb, 0x0e, 0xa8, 0xeb,
+  0x03, 0xbe, 0xaa, 0xcd, 0x6a, 0xf7, 0xca, 0x81, 0x7f, 0x71, 0x1a, 0x36, 0xce, 0x66, 0xbb, 0x71,
+  0x7e, 0x83, 0x1b, 0x9b, 0xea, 0xc2, 0x74, 0x6d, 0x7e, 0xa8, 0x68, 0xd2, 0xf1, 0xba, 0xbd, 0x83,
+  0xf1, 0xb6, 0x45, 0x37, 0x4d, 0xba, 0x08, 0xe1, 0xd4, 0x4f, 0x1c, 0x71, 0x71, 0xe6, 0x79, 0x54,
+  0x4f, 0x85, 0xb7, 0xe7, 0xd1, 0xf4, 0x0a, 0x77, 0xcd, 0xe3, 0xda, 0xca, 0x0b, 0xb9, 0xf2, 0x78,
+  0x7a, 0x28, 0x61, 0xe0, 0xb9, 0x6d, 0x3b, 0xc9, 0x1b, 0xae, 0x64, 0x86, 0xc1, 0x82, 0xad, 0x95,
+  0x21, 0x74, 0xf1, 0x3e, 0xb6, 0xab, 0x90, 0xe3, 0x7d, 0x39, 0xaf, 0xe2, 0x48, 0xf1, 0x5e, 0x8d,
+  0x95, 0xd7, 0x9a, 0x4e, 0xa4, 0xd0, 0x96, 0xb7, 0xb2, 0xb7, 0x52, 0xda, 0xdb, 0x52, 0x9a, 0xae,
+  0x15, 0x8f, 0xbf, 0x37, 0xa3, 0x95, 0xb4, 0xe8, 0x80, 0x49, 0x99, 0x41, 0x15, 0xb0, 0x3f, 0x22,
+  0x6b, 0x88, 0x08, 0xbe, 0x01, 0x89, 0x21, 0x40, 0x37, 0x48, 0xa6, 0x8b, 0x34, 0x47, 0xb9, 0x41,
+  0x82, 0xe3, 0xd8, 0x72, 0x0c, 0x36, 0x51, 0xd1, 0x8d, 0x83, 0x09, 0x8f, 0x51, 0x8a, 0xb5, 0x93,
+  0x26, 0x20, 0xd7, 0xba, 0x4f, 0x56, 0x2b, 0x83, 0xd5, 0xd7, 0x8a, 0xd8, 0x69, 0x5b, 0x2a, 0xec,
+  0xe8, 0xd2, 0xf9, 0x4b, 0xc5, 0xe6, 0x92, 0xbc, 0x86, 0xec, 0x11, 0x5b, 0x30, 0xba, 0x9d, 0x83,
+  0x97, 0x73, 0x74, 0x58, 0xda, 0x81, 0x54, 0x01, 0x1e, 0xe4, 0x11, 0x3e, 0xdd, 0xda, 0x31, 0xc1,
+  0xd3, 0x2a, 0x16, 0xd1, 0x29, 0xdd, 0x56, 0x52, 0xae, 0xe8, 0x98, 0x1d, 0xc0, 0x2a, 0xc8, 0xbb,
+  0x40, 0x26, 0x7e, 0x03, 0xec, 0x63, 0xc1, 0x31, 0x59, 0x29, 0x47, 0x3c, 0x91, 0x40, 0x00, 0x6c,
+  0x4e, 0xd9, 0x15, 0x0e, 0x58, 0xc0, 0xdf, 0x6a, 0x24, 0x1e, 0x86, 0xe0, 0x8f, 0xe0, 0xed, 0x9b,
+  0x4a, 0xa2, 0x85, 0x92, 0x42, 0x85, 0x6a, 0x59, 0xac, 0x9a, 0xfe, 0x57, 0x57, 0xac, 0x6e, 0x66,
+  0xc4, 0x95, 0x36, 0x13, 0x44, 0x80, 0x0c, 0x84, 0x7b, 0x25, 0xc1, 0xe8, 0xfd, 0xf4, 0xf3, 0x08,
+  0x81, 0x0f, 0x75, 0xfc, 0x8b, 0xd5, 0x37, 0x6c, 0x00, 0x63, 0x54, 0x02, 0x37, 0x6d, 0x92, 0xd4,
+  0x36, 0xed, 0xd9, 0xaf, 0x8c, 0xc2, 0x20, 0xfd, 0xb6, 0xba, 0x6d, 0x5a, 0xc8, 0x5f, 0x3f, 0x72,
+  0xee, 0x52, 0xb0, 0x0d, 0x69, 0x56, 0x09, 0x3e, 0x78, 0xd4, 0xd4, 0xaf, 0x65, 0x14, 0x86, 0x31,
+  0xff, 0x6a, 0x15, 0x2b, 0xad, 0x98, 0xb5, 0x48, 0xd6, 0x77, 0x2a, 0x57, 0x9e, 0xb9, 0x24, 0x69,
+  0xbe, 0xf9, 0xb8, 0xfa, 0x92, 0x2a, 0x12, 0xab, 0x6d, 0xaa, 0x88, 0x1d, 0x35, 0x2d, 0x0c, 0xe6,
+  0xbd, 0x37, 0x90, 0x9e, 0x8a, 0xee, 0x0f, 0x7c, 0xba, 0x00, 0xcf, 0x4e, 0xf7, 0x43, 0xf0, 0xbb,
+  0x9f, 0xab, 0x55, 0x7e, 0xc3, 0x13, 0xad, 0x91, 0x89, 0x56, 0xc9, 0xcf, 0xbf, 0x4c, 0x30, 0x89,
+  0xc7, 0x12, 0x30, 0x05, 0x05, 0xaf, 0x90, 0xb1, 0xc2, 0xd4, 0x04, 0x34, 0x23, 0xcd, 0xa5, 0xb1,
+  0x3e, 0x6b, 0x54, 0xa1, 0x70, 0xe3, 0x8b, 0xc7, 0x66, 0xf0, 0x5c, 0xf9, 0xd2, 0xb1, 0x3e, 0xcc,
+  0xfa, 0xa4, 0xb3, 0x31, 0x90, 0xc2, 0x19, 0xcb, 0x00, 0xea, 0x6d, 0xa1, 0xbf, 0xb6, 0xa8, 0xba,
+  0x3e, 0x09, 0x5b, 0xfd, 0x4c, 0x9f, 0xd4, 0x52, 0x5d, 0x3b, 0x51, 0x5b, 0x03, 0x74, 0x5a, 0xdd,
+  0xb9, 0xa3, 0x11, 0x96, 0x6a, 0xda, 0xcd, 0xfb, 0xea, 0x66, 0x5e, 0xd3, 0x81, 0x11, 0x09, 0x94,
+  0x19, 0x5d, 0x5c, 0x48, 0x50, 0x23, 0x95, 0x87, 0xec, 0x5b, 0x2c, 0x94, 0xc0, 0x82, 0x38, 0xe0,
+  0x30, 0x75, 0xb7, 0xc5, 0xbf, 0x02, 0xa0, 0xd5, 0x72, 0x2e, 0x2f, 0x8d, 0x07, 0x2c, 0xd9, 0xf8,
+  0x49, 0xda, 0xf1, 0x9f, 0xc0, 0x8e, 0x1f, 0xc0, 0xcf, 0xfe, 0x3e, 0x84, 0xdc, 0x65, 0xbe, 0x5f,
+  0x2f, 0x88, 0x49, 0x5a, 0x28, 0x19, 0xc5, 0x3a, 0xff, 0x4f, 0x97, 0x65, 0xc2, 0x6d, 0x7c, 0x34,
+  0xf5, 0x1f, 0xaa, 0x64, 0x15, 0x24, 0x4c, 0xef, 0xc7, 0x92, 0x69, 0xac, 0x4a, 0x95, 0x55, 0x30,
+  0xab, 0x9a, 0xa6, 0xf6, 0xe1, 0x79, 0x5e, 0xdd, 0x89, 0xf0, 0x8f, 0x57, 0xf9, 0x1c, 0x90, 0x16,
+  0xa8, 0xb2, 0x21, 0x61, 0x48, 0xcd, 0xd9, 0x5a, 0xde, 0xb5, 0x32, 0xb6, 0x6d, 0x6f, 0xd2, 0xe8,
+  0x03, 0xda, 0xa1, 0x72, 0xf4, 0xe0, 0x80, 0xa2, 0xf7, 0x48, 0x7e, 0x47, 0xf2, 0x10, 0xde, 0x7f,
+  0xf5, 0xae, 0x54, 0xd2, 0xad, 0x6e, 0x3f, 0xe4, 0xc4, 0x10, 0x2a, 0x45, 0x37, 0xb8, 0x6c, 0x16,
+  0x16, 0xed, 0xb2, 0x9e, 0x64, 0xd6, 0xf6, 0xfa, 0xf6, 0x62, 0xb4, 0x6c, 0x61, 0x39, 0xa0, 0x6d,
+  0x0f, 0x53, 0x8f, 0xe5, 0x4f, 0x5a, 0xaa, 0xc1, 0x3a, 0x81, 0xc7, 0x30, 0xaf, 0x59, 0x39, 0xa7,
+  0x14, 0x51, 0x95, 0xce, 0x47, 0xbb, 0x4c, 0x08, 0x0d, 0xb7, 0xa7, 0xc5, 0x86, 0xee, 0x1c, 0x32,
+  0x3d, 0x33, 0xeb, 0x57, 0x0f, 0xab, 0x12, 0xdb, 0x32, 0xac, 0x49, 0xa4, 0x4c, 0x12, 0x15, 0x95,
+  0x36, 0x42, 0xea, 0xf8, 0x67, 0x30, 0xca, 0x24, 0xb5, 0x05, 0x23, 0x75, 0xd4, 0x1d, 0xb4, 0xa9,
+  0x60, 0x3e, 0x56, 0x75, 0xc3, 0x7d, 0xaa, 0x1b, 0x3a, 0xff, 0xf8, 0xfb, 0x09, 0x5a, 0x77, 0x4b,
+  0x7d, 0x3c, 0xab, 0x22, 0xb3, 0x48, 0xd7, 0x3c, 0xc7, 0x1b, 0x1d, 0x98, 0x46, 0x4b, 0xaa, 0x08,
+  0x31, 0x52, 0xb5, 0x1d, 0x90, 0x66, 0xe2, 0x85, 0x08, 0xed, 0x44, 0x2a, 0x11, 0x1d, 0x0e, 0xad,
+  0x31, 0x56, 0xa2, 0x3c, 0x4d, 0x85, 0xc1, 0x38, 0x8d, 0xf2, 0x69, 0x2c, 0x71, 0xe6, 0x43, 0x0a,
+  0x72, 0x6a, 0x48, 0xc2, 0x54, 0xb4, 0xe0, 0x38, 0xa7, 0x4b, 0x63, 0x3b, 0x03, 0xa7, 0x7d, 0xf6,
+  0x98, 0x36, 0x8f, 0x66, 0xf6, 0x71, 0x13, 0x2f, 0x8d, 0xa9, 0x20, 0xc6, 0x66, 0x79, 0x75, 0xba,
+  0x25, 0x2d, 0x45, 0xb4, 0x7a, 0x3f, 0x96, 0xb9, 0x29, 0xa5, 0xcd, 0x26, 0x37, 0xb5, 0xf3, 0xdc,
+  0x0e, 0xc3, 0xbb, 0x0d, 0xa8, 0x34, 0x79, 0x90, 0x14, 0x59, 0x80, 0x97, 0x78, 0xcc, 0x74, 0x6a,
+  0x2a, 0x75, 0x67, 0x7b, 0x2a, 0x2f, 0x28, 0x1f, 0x01, 0x8d, 0x79, 0x5a, 0x14, 0x8b, 0x20, 0xca,
+  0x9d, 0x7a, 0x7a, 0xbf, 0x88, 0x42, 0xfe, 0x02, 0x87, 0xd5, 0xce, 0x43, 0xca, 0x45, 0xfa, 0xc2,
+  0x75, 0x74, 0x2d, 0xf9, 0xaf, 0x01, 0x43, 0xe1, 0x7e, 0xf1, 0x3a, 0x39, 0xb3, 0x49, 0xaa, 0x53,
+  0x5b, 0x2c, 0xd2, 0x6b, 0xd9, 0xc5, 0xd7, 0xa2, 0xe9, 0x3d, 0x33, 0xb5, 0x76, 0xea, 0xac, 0x77,
+  0xfc, 0xe1, 0xf7, 0x74, 0xf5, 0xd1, 0x64, 0x42, 0x99, 0xf0, 0x31, 0xf8, 0x81, 0xc1, 0xfe, 0x34,
+  0x8e, 0x40, 0x74, 0x7f, 0xb2, 0x7a, 0xb6, 0x95, 0x9e, 0x3f, 0x8f, 0x6a, 0x11, 0x13, 0x40, 0xc0,
+  0x66, 0xc9, 0x23, 0x30, 0xa2, 0x20, 0x79, 0xb4, 0x78, 0x74, 0x7b, 0x6c, 0xce, 0xc5, 0x18, 0xa6,
+  0xe3, 0xc9, 0xc9, 0xf9, 0x6b, 0xd7, 0xf3, 0xa3, 0x64, 0x8d, 0x1f, 0xf5, 0xb8, 0x9e, 0xe7, 0x6f,
+  0xca, 0xd2, 0x15, 0x5a, 0xb7, 0x0d, 0xf8, 0x08, 0xd2, 0x21, 0x70, 0x11, 0x1b, 0xf0, 0x0f, 0xb5,
+  0x90, 0xbd, 0xe5, 0x7c, 0xd4, 0x92, 0x42, 0xfb, 0xe7, 0xe1, 0xb7, 0x1a, 0x3f, 0xc4, 0x28, 0xc9,
+  0xe7, 0x9f, 0x21, 0x34, 0x11, 0xf2, 0x58, 0x30, 0x34, 0xb5, 0xdc, 0x5a, 0xf1, 0xdc, 0x76, 0xf3,
+  0x41, 0x0e, 0xb4, 0x57, 0x0a, 0xad, 0x40, 0xa4, 0x2c, 0xe9, 0x63, 0x9d, 0x45, 0x96, 0xfa, 0x1f,
+  0xaa, 0x08, 0xda, 0x96, 0x46, 0x14, 0x6e, 0xaa, 0x65, 0x66, 0x59, 0x9a, 0xeb, 0x94, 0x28, 0xa9,
+  0xd4, 0x9c, 0x54, 0x32, 0x59, 0x1c, 0x03, 0x39, 0x79, 0x82, 0xec, 0xcb, 0x17, 0xd6, 0xa7, 0xfb,
+  0xe7, 0x9a, 0x8a, 0xae, 0x2e, 0xf0, 0x61, 0x27, 0x26, 0xe5, 0x20, 0x2f, 0xd3, 0x72, 0x89, 0xfd,
+  0x0a, 0xb4, 0x45, 0x58, 0x00, 0xa1, 0x4b, 0xcc, 0x96, 0x58, 0x68, 0xe5, 0xd6, 0xb2, 0x2e, 0x81,
+  0x38, 0x46, 0x4d, 0xdd, 0x6e, 0xb9, 0xe3, 0xb5, 0xf6, 0xbe, 0x08, 0x77, 0xb0, 0x13, 0x6e, 0xd7,
+  0x47, 0x15, 0x8d, 0xdd, 0x52, 0xbd, 0x2c, 0xb7, 0x69, 0x41, 0xd8, 0x02, 0x46, 0x37, 0xfe, 0x30,
+  0x47, 0x94, 0x15, 0x4c, 0xe4, 0xc9, 0xf3, 0xbe, 0xbc, 0x13, 0xdb, 0x88, 0xa0, 0xbd, 0x58, 0xcd,
+  0xe4, 0xac, 0x8f, 0xb5, 0x4b, 0xb1, 0xcb, 0x0f, 0x84, 0xe4, 0x57, 0xd7, 0xe6, 0x3b, 0x24, 0x6b,
+  0xfa, 0xaf, 0xd8, 0xe0, 0xd5, 0xcf, 0x52, 0x2a, 0x76, 0xaa, 0xf9, 0x49, 0xc8, 0x32, 0x5d, 0x15,
+  0x74, 0x3f, 0x13, 0x2f, 0x66, 0xe9, 0xdd, 0x5e, 0xb3, 0x6e, 0x3b, 0x46, 0xc5, 0x3c, 0xa0, 0x61,
+  0xe5, 0xce, 0xb1, 0x0e, 0xef, 0xea, 0xb7, 0xb4, 0x1b, 0xf7, 0xa5, 0xe8, 0x3f, 0x04, 0x30, 0x55,
+  0x48, 0x73, 0xc4, 0xd7, 0xf8, 0x5e, 0x1b, 0x21, 0x51, 0x8b, 0x2f, 0x2e, 0xcd, 0x27, 0x28, 0xf6,
+  0xff, 0x7e, 0xd5, 0xfc, 0x98, 0xa5, 0x7e, 0x2e, 0x68, 0x79, 0x4e, 0x3c, 0xf7, 0x7b, 0x04, 0x7f,
+  0xf7, 0xf4, 0x97, 0x26, 0x57, 0x69, 0x02, 0xeb, 0x01, 0x21, 0x2d, 0xfe, 0xef, 0x6d, 0x73, 0x4e,
+  0xff, 0x1d, 0x9b, 0xaa, 0x16, 0xee, 0x75, 0xf0, 0x0b, 0x48, 0x73, 0xf3, 0x46, 0xf3, 0x65, 0xdd,
+  0x25, 0x6b, 0xb0, 0xa5, 0xae, 0x68, 0x55, 0x19, 0xb3, 0x2f, 0x7b, 0x29, 0x4e, 0xbe, 0x8e, 0x91,
+  0xaf, 0xbf, 0xc0, 0x65, 0x15, 0x4b, 0x25, 0x47, 0x49, 0x2b, 0x4b, 0x95, 0xcb, 0x5c, 0xc4, 0x93,
+  0xfc, 0xcf, 0x18, 0xfe, 0x17, 0xda, 0x2e, 0xb1, 0x5b, 0xdc, 0x4e, 0x00, 0x00,
+};
+
+#endif
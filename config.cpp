@@ -3,6 +3,7 @@
 #include <time.h>
 
 Config config;
+static uint32_t configVersion = 0;
 
 static float clampf(float v, float lo, float hi)
 {
@@ -42,6 +43,7 @@ void loadConfig()
   tmp.hysteresis    = clampf(tmp.hysteresis, 0.1f, 5.0f);
   if (tmp.boostMinutes < 0)   tmp.boostMinutes = 0;
   if (tmp.boostMinutes > 240) tmp.boostMinutes = 240;
+  if (tmp.aggReadings > AGG_READINGS_MAX) tmp.aggReadings = 0;
 
   config = tmp;
   Serial.println(F("[CONFIG] Loaded from EEPROM."));
@@ -57,6 +59,111 @@ void saveConfig()
 {
   EEPROM.put(EEPROM_ADDR, config);
   EEPROM.commit();
+  configVersion++;
+}
+
+/***************** getConfigVersion *********************************************/
+uint32_t getConfigVersion()
+{
+  return configVersion;
+}
+
+/***************** configPatchSet ***********************************************/
+ConfigPatchResult configPatchSet(ConfigPatch& p, const char* key, float value)
+{
+  if (isnan(value))
+  {
+    return CFG_PATCH_RANGE;
+  }
+
+  if (strcmp(key, "daySetPoint") == 0 || strcmp(key, "nightSetPoint") == 0 ||
+      strcmp(key, "setPoint") == 0)
+  {
+    if (value < 5.0f || value > 35.0f)
+    {
+      return CFG_PATCH_RANGE;
+    }
+    if (key[0] != 'n')
+    {
+      p.daySetPoint = value;
+      p.fields |= CFG_F_DAY_SP;
+    }
+    if (key[0] != 'd')
+    {
+      p.nightSetPoint = value;
+      p.fields |= CFG_F_NIGHT_SP;
+    }
+  }
+  else if (strcmp(key, "dayStart") == 0 || strcmp(key, "nightStart") == 0)
+  {
+    if (value < 0.0f || value > 1439.0f)
+    {
+      return CFG_PATCH_RANGE;
+    }
+    if (key[0] == 'd')
+    {
+      p.dayStartMin = (int)value;
+      p.fields |= CFG_F_DAY_START;
+    }
+    else
+    {
+      p.nightStartMin = (int)value;
+      p.fields |= CFG_F_NIGHT_START;
+    }
+  }
+  else if (strcmp(key, "hysteresis") == 0)
+  {
+    if (value < 0.1f || value > 5.0f)
+    {
+      return CFG_PATCH_RANGE;
+    }
+    p.hysteresis = value;
+    p.fields |= CFG_F_HYSTERESIS;
+  }
+  else if (strcmp(key, "boostMinutes") == 0)
+  {
+    if (value < 0.0f || value > 240.0f)
+    {
+      return CFG_PATCH_RANGE;
+    }
+    p.boostMinutes = (int)value;
+    p.fields |= CFG_F_BOOST_MIN;
+  }
+  else if (strcmp(key, "aggReadings") == 0)
+  {
+    if (value < 0.0f || value > (float)AGG_READINGS_MAX)
+    {
+      return CFG_PATCH_RANGE;
+    }
+    p.aggReadings = (int)value;
+    p.fields |= CFG_F_AGG_READINGS;
+  }
+  else
+  {
+    return CFG_PATCH_UNKNOWN;
+  }
+  return CFG_PATCH_OK;
+}
+
+/***************** applyConfigPatch *********************************************/
+bool applyConfigPatch(const ConfigPatch& p)
+{
+  Config next = config;
+  if (p.fields & CFG_F_DAY_SP)      next.daySetPoint   = p.daySetPoint;
+  if (p.fields & CFG_F_NIGHT_SP)    next.nightSetPoint = p.nightSetPoint;
+  if (p.fields & CFG_F_DAY_START)   next.dayStartMin   = (uint16_t)p.dayStartMin;
+  if (p.fields & CFG_F_NIGHT_START) next.nightStartMin = (uint16_t)p.nightStartMin;
+  if (p.fields & CFG_F_HYSTERESIS)  next.hysteresis    = p.hysteresis;
+  if (p.fields & CFG_F_BOOST_MIN)   next.boostMinutes  = p.boostMinutes;
+  if (p.fields & CFG_F_AGG_READINGS) next.aggReadings = (uint16_t)p.aggReadings;
+
+  if (memcmp(&next, &config, sizeof(Config)) == 0)
+  {
+    return false;
+  }
+  config = next;
+  saveConfig();
+  return true;
 }
 
 /***************** getSetPoint **************************************************/
@@ -186,6 +293,12 @@ void setBoostMinutes(int v)
   saveConfig();
 }
 
+/***************** getAggReadings ***********************************************/
+int getAggReadings()
+{
+  return config.aggReadings;
+}
+
 /***************** getBoostEndTime **********************************************/
 unsigned long getBoostEndTime()
 {
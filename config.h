@@ -63,7 +63,7 @@ struct Config
 {
   uint32_t magic = CONFIG_MAGIC;
   uint16_t version = CONFIG_VERSION;
-  uint16_t reserved = 0;
+  uint16_t aggReadings = 0;              // MQTT-Aggregat: Messungen je Fenster, 0 = aus (früher reserved)
 
   // Control parameters
   float       daySetPoint   = 21.0f;     // °C
@@ -100,8 +100,9 @@ extern Config config;
 #define HISTORY_FILE_PATH "/hist.bin"
 #endif
 
-#ifndef HISTORY_CAPACITY_RECORDS
-#define HISTORY_CAPACITY_RECORDS 6000  // 6000*8B ≈ 48 KB auf FS
+// ---------- MQTT Aggregate ----------
+#ifndef AGG_READINGS_MAX
+#define AGG_READINGS_MAX 720     // 1 h bei 5 s Messtakt
 #endif
 
 
@@ -121,6 +122,74 @@ void loadConfig();
  ******************************************************************************/
 void saveConfig();
 
+/***************** getConfigVersion *********************************************
+ * params: none
+ * return: uint32_t
+ * Description:
+ * Incremented by every saveConfig(), i.e. by every setter. Lets observers
+ * (web events) detect config changes without comparing fields.
+ ******************************************************************************/
+uint32_t getConfigVersion();
+
+/***************** ConfigPatch **************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Several config changes applied together with a single EEPROM commit.
+ * Fill with configPatchSet() (validates each field), then applyConfigPatch().
+ * `fields` marks the valid members (CFG_F_*).
+ ******************************************************************************/
+enum ConfigField : uint8_t
+{
+  CFG_F_DAY_SP       = 1 << 0,
+  CFG_F_NIGHT_SP     = 1 << 1,
+  CFG_F_DAY_START    = 1 << 2,
+  CFG_F_NIGHT_START  = 1 << 3,
+  CFG_F_HYSTERESIS   = 1 << 4,
+  CFG_F_BOOST_MIN    = 1 << 5,
+  CFG_F_AGG_READINGS = 1 << 6
+};
+
+struct ConfigPatch
+{
+  uint8_t fields        = 0;
+  float   daySetPoint   = 0.0f;
+  float   nightSetPoint = 0.0f;
+  float   hysteresis    = 0.0f;
+  int     dayStartMin   = 0;
+  int     nightStartMin = 0;
+  int     boostMinutes  = 0;
+  int     aggReadings   = 0;
+};
+
+enum ConfigPatchResult : uint8_t
+{
+  CFG_PATCH_OK,
+  CFG_PATCH_UNKNOWN,    // kein Config-Feld
+  CFG_PATCH_RANGE       // ausserhalb des gültigen Bereichs / keine Zahl
+};
+
+/***************** configPatchSet ***********************************************
+ * params: p, key, value
+ * return: ConfigPatchResult
+ * Description:
+ * Validates one field and records it in the patch. Keys as in the MQTT
+ * state message: daySetPoint, nightSetPoint, setPoint (= both), dayStart,
+ * nightStart (minutes since midnight), hysteresis, boostMinutes, aggReadings
+ * (sensor readings per MQTT aggregate window, 0 = off). Out of range is
+ * rejected, not clamped, so a bad request changes nothing.
+ ******************************************************************************/
+ConfigPatchResult configPatchSet(ConfigPatch& p, const char* key, float value);
+
+/***************** applyConfigPatch *********************************************
+ * params: p
+ * return: bool
+ * Description:
+ * Applies all fields of the patch at once and commits once. A patch that
+ * changes nothing does not touch flash. Returns true if it was committed.
+ ******************************************************************************/
+bool applyConfigPatch(const ConfigPatch& p);
+
 /***************** Accessors ****************************************************/
 float getSetPoint();             // aktueller (wirksamer) Sollwert
 float getDaySetPoint();
@@ -139,6 +208,8 @@ void  setHysteresis(float v);
 int   getBoostMinutes();
 void  setBoostMinutes(int v);
 
+int   getAggReadings();          // 0 = keine Aggregate (siehe mqttagg.h)
+
 unsigned long getBoostEndTime();
 void  setBoostEndTime(unsigned long t);
 
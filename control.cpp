@@ -2,11 +2,13 @@
 #include "config.h"
 #include "sensor.h"
 #include "led.h"
+#include "phases.h"
 
 /***************** Local State **************************************************/
 static ControlMode  activeMode = MODE_AUTO;  // internal active mode
 static ControlMode  prevMode   = (ControlMode)(-1); // to detect on-entry
 static ControlState controlState = STATE_IDLE;
+static uint32_t     relaySwitches = 0;   // Relais-Schaltspiele seit Boot
 
 /***************** isHeaterOn ***************************************************
  * params: none
@@ -20,18 +22,31 @@ bool isHeaterOn()
 }
 
 /***************** setHeater ****************************************************
- * params: on - desired heater state
+ * params: on - desired heater state, cause - reason for the phase log
  * return: void
  * Description:
- * Sets the heater relay output.
+ * Sets the heater relay output. Actual transitions are written to the
+ * phase log with their exact time.
  ******************************************************************************/
-void setHeater(bool on)
+void setHeater(bool on, HeaterCause cause)
 {
+  const bool wasOn = isHeaterOn();
   digitalWrite(RELAY_PIN, on ? HIGH : LOW);
   ledSetBaseFromHeater(on);
+  if (wasOn != on)
+  {
+    relaySwitches++;
+    logHeaterEdge(on, cause);
+  }
 }
 
 
+/***************** getRelaySwitchCount ******************************************/
+uint32_t getRelaySwitchCount()
+{
+  return relaySwitches;
+}
+
 /***************** initControl **************************************************
  * params: none
  * return: void
@@ -41,7 +56,7 @@ void setHeater(bool on)
 void initControl()
 {
   pinMode(RELAY_PIN, OUTPUT);
-  setHeater(false);
+  setHeater(false, CAUSE_INIT);
   controlState = STATE_IDLE;
 
   // Pick up the persisted request as initial active mode.
@@ -57,7 +72,7 @@ void initControl()
  ******************************************************************************/
 void requestHeaterOffNow()
 {
-  setHeater(false);
+  setHeater(false, CAUSE_MANUAL);
 
   // Reset state so AUTO can re-evaluate cleanly on next loop
   controlState = STATE_IDLE;
@@ -103,7 +118,7 @@ void handleControl()
       // --- On-Entry ---
       if (prevMode != MODE_OFF)
       {
-        setHeater(false);
+        setHeater(false, CAUSE_MODE);
         controlState = STATE_IDLE;
         prevMode = MODE_OFF;
       }
@@ -112,7 +127,7 @@ void handleControl()
       if (!sensorOk)
       {
         // Fail-safe: even in OFF we reflect the error state (heater remains off)
-        setHeater(false);
+        setHeater(false, CAUSE_SENSOR);
         controlState = STATE_ERROR;
         break;
       }
@@ -145,7 +160,7 @@ void handleControl()
           end = now + (unsigned long)getBoostMinutes() * 60000UL;
           setBoostEndTime(end);
         }
-        setHeater(true);
+        setHeater(true, CAUSE_BOOST);
         controlState = STATE_HEATING;
         prevMode = MODE_BOOST;
       }
@@ -154,14 +169,14 @@ void handleControl()
       if (!sensorOk)
       {
         // Fail-safe OFF, aber BOOST-Ende bleibt gespeichert
-        setHeater(false);
+        setHeater(false, CAUSE_SENSOR);
         controlState = STATE_ERROR;
         break;
       }
       if (controlState == STATE_ERROR)
       {
         // Sensor wieder ok → BOOST erzwingt HEATING, aber nur auf Transition:
-        setHeater(true);
+        setHeater(true, CAUSE_SENSOR);
         controlState = STATE_HEATING;
       }
 
@@ -201,7 +216,7 @@ void handleControl()
       // --- Error Handling (in-mode) ---
       if (!sensorOk)
       {
-        setHeater(false);
+        setHeater(false, CAUSE_SENSOR);
         controlState = STATE_ERROR;
         break;
       }
@@ -222,12 +237,12 @@ void handleControl()
       // --- AUTO Regelung (nur auf Flankenwechsel) ---
       if (controlState != STATE_HEATING && temp <= setp - hyst)
       {
-        setHeater(true);
+        setHeater(true, CAUSE_AUTO);
         controlState = STATE_HEATING;
       }
       else if (controlState != STATE_IDLE && temp >= setp + hyst)
       {
-        setHeater(false);
+        setHeater(false, CAUSE_AUTO);
         controlState = STATE_IDLE;
       }
       break;
@@ -254,12 +269,12 @@ ControlMode getControlMode()
  * params: m
  * return: void
  * Description:
- * Sets control mode and persists.
+ * Sets control mode. The mode is not part of Config, so nothing is written
+ * to flash (BOOST persists its end time via setBoostEndTime()).
  ******************************************************************************/
 void setControlMode(ControlMode m)
 {
   activeMode = m;
-  saveConfig();
 }
 
 /***************** setControlMode ***********************************************
@@ -306,3 +321,23 @@ const char* stateToStr(ControlState s)
     default:            return "?";
   }
 }
+
+/***************** causeToStr ***************************************************
+ * params: c
+ * return: const char*
+ * Description:
+ * Convert heater switch cause to readable string.
+ ******************************************************************************/
+const char* causeToStr(HeaterCause c)
+{
+  switch (c)
+  {
+    case CAUSE_AUTO:    return "AUTO";
+    case CAUSE_BOOST:   return "BOOST";
+    case CAUSE_MODE:    return "MODE";
+    case CAUSE_SENSOR:  return "SENSOR";
+    case CAUSE_MANUAL:  return "MANUAL";
+    case CAUSE_INIT:    return "INIT";
+    default:            return "?";
+  }
+}
@@ -24,11 +24,28 @@ enum ControlState
   STATE_ERROR
 };
 
+/***************** HeaterCause **************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * Why the relay was switched; stored with every edge in the phase log.
+ ******************************************************************************/
+enum HeaterCause
+{
+  CAUSE_AUTO = 0,     // Hysterese in AUTO
+  CAUSE_BOOST,        // BOOST Start/Ende
+  CAUSE_MODE,         // Moduswechsel (OFF, Verlassen von BOOST)
+  CAUSE_SENSOR,       // Fail-safe bei Sensorfehler / Erholung
+  CAUSE_MANUAL,       // requestHeaterOffNow()
+  CAUSE_INIT          // Start
+};
+
 /***************** API **********************************************************/
 void initControl();
 void handleControl();
 bool isHeaterOn();
-void setHeater(bool on);
+uint32_t getRelaySwitchCount();   // Schaltspiele (EIN/AUS-Wechsel) seit Boot
+void setHeater(bool on, HeaterCause cause);
 
 /***************** requestHeaterOffNow ******************************************
  * params: none
@@ -44,5 +61,6 @@ void setControlMode(ControlMode m);
 
 const char* modeToStr(ControlMode m);
 const char* stateToStr(ControlState s);
+const char* causeToStr(HeaterCause c);
 
 #endif // CONTROL_H
@@ -3,136 +3,1074 @@
 #include "ntp.h"
 #include "sensor.h"
 #include "control.h"
+#include "rollup.h"
 #include <LittleFS.h>
 
 struct HistoryHeader
 {
   uint32_t magic;
   uint16_t version;
-  uint16_t recSize;
-  uint32_t capacity;   // Anzahl Records
-  uint32_t head;       // nächste Schreibposition (0..capacity-1)
-  uint32_t count;      // gültige Anzahl
-  uint32_t reserved;
+  uint16_t blockSize;  // Bytes pro Block (v4: recSize)
+  uint32_t capacity;   // Anzahl Blöcke (v4: Anzahl Records)
+  uint32_t head;       // offener Block, in den geschrieben wird (v4: Schreibposition)
+  uint32_t blocks;     // belegte Blöcke inkl. head (v4: count)
+  uint32_t seq;        // laufende Nummer des nächsten Samples
 };
 
-static const uint32_t HIST_MAGIC   = 0x48495354UL; // "HIST"
-static const uint16_t HIST_VERSION = 4;
+/***************** BlockHeader **************************************************
+ * Description:
+ * Start of every block. The base sample is stored as-is, every further
+ * sample as a bit-packed delta to its predecessor (see encodeSample()).
+ * firstSeq/keyTs make the block headers a seek index: a range query
+ * binary-searches them and decodes at most two blocks. keyBack links a
+ * block without epoch samples to the last block with one, so a run of such
+ * blocks is skipped instead of decoded.
+ ******************************************************************************/
+struct BlockHeader
+{
+  uint32_t  firstSeq;    // Sequenz von base
+  uint32_t  keyTs;       // erster Epoch-Zeitstempel im Block (UINT32_MAX: keiner)
+  uint16_t  count;       // Samples inkl. base (0 = unbenutzt)
+  uint16_t  bits;        // belegte Bits im Delta-Strom
+  uint16_t  intervalSec; // Sollabstand beim Schreiben (Delta-Basis für tsSec)
+  uint16_t  keyBack;     // ohne keyTs: Blöcke zurück zum letzten Block mit keyTs (0: keiner)
+  LogSample base;
+};
+
+static const uint32_t HIST_MAGIC      = 0x48495354UL; // "HIST"
+static const uint16_t HIST_VERSION    = 5;
+static const uint16_t HIST_VERSION_V4 = 4;            // 12-Byte-Records, wird migriert
+static const uint32_t HIST_EPOCH_MIN  = 1609459200UL; // 2021-01-01, wie validEpoch() in ntp.cpp
+static const uint32_t HIST_KEY_BLOCKS = 4;            // max. Vorausschau für Uptime-Blöcke
+
+static const uint32_t HIST_PAYLOAD_BYTES   = HISTORY_BLOCK_BYTES - sizeof(BlockHeader);
+static const uint32_t HIST_PAYLOAD_BITS    = HIST_PAYLOAD_BYTES * 8UL;
+static const uint32_t HIST_CAPACITY_BLOCKS = (HISTORY_FILE_BYTES - sizeof(HistoryHeader)) / HISTORY_BLOCK_BYTES;
+
+static_assert(HISTORY_BLOCK_BYTES >= sizeof(BlockHeader) + 32, "HISTORY_BLOCK_BYTES too small");
+static_assert(HIST_CAPACITY_BLOCKS >= 2, "HISTORY_FILE_BYTES too small for two blocks");
 
 static File           histFile;
 static HistoryHeader  hdr;
+static uint32_t       oldestSeq = 0;    // erstes Sample im ältesten Block
 
-/***************** fileOpenOrCreate ********************************************
+// Offener Block: RAM-Spiegel, wird bei jedem Flush geschrieben
+static BlockHeader    openHdr;
+static uint8_t        openBits[HIST_PAYLOAD_BYTES];
+static LogSample      openLast;         // Delta-Basis für das nächste Sample
+
+// Write-behind: Samples sammeln, dann in einem Rutsch schreiben
+static LogSample      stage[HISTORY_STAGE_RECORDS];
+static uint32_t       stageCount   = 0;
+static unsigned long  stageSinceMs = 0;
+static HistoryStats   histStats    = {};
+
+/***************** BlockDecoder *************************************************
+ * Description:
+ * Read position inside the last decoded block, so cursors reading forward
+ * decode every block exactly once.
+ ******************************************************************************/
+struct BlockDecoder
+{
+  bool        valid;
+  uint32_t    idx;       // Blockindex im Ring
+  BlockHeader bh;
+  uint8_t     bits[HIST_PAYLOAD_BYTES];
+  uint32_t    pos;       // Bitposition hinter cur
+  uint32_t    seq;       // Sequenz von cur
+  LogSample   cur;
+};
+
+static BlockDecoder   dec;
+
+/***************** blockOffset **************************************************
+ * params: idx
+ * return: size_t
+ * Description:
+ * Byte-Offset eines Blocks in der Datei.
+ ******************************************************************************/
+static inline size_t blockOffset(uint32_t idx)
+{
+  return sizeof(hdr) + (size_t)idx * hdr.blockSize;
+}
+
+/***************** blockAt ******************************************************
+ * params: pos
+ * return: uint32_t
+ * Description:
+ * Blockindex der Ring-Position pos (0 = ältester Block, blocks-1 = head).
+ ******************************************************************************/
+static inline uint32_t blockAt(uint32_t pos)
+{
+  return (hdr.head + hdr.capacity - (hdr.blocks - 1) + pos) % hdr.capacity;
+}
+
+/***************** isPlausibleSample ********************************************
+ * params: s
+ * return: bool
+ * Description:
+ * Cheap sanity check for a record read back from flash. Pre-allocated slots
+ * are zero-filled, so tsSec == 0 marks "never written".
+ ******************************************************************************/
+static bool isPlausibleSample(const LogSample& s)
+{
+  if (s.tsSec == 0)
+  {
+    return false;
+  }
+  if ((s.flags & 0xFE) != 0)
+  {
+    return false; // reservierte Bits gesetzt
+  }
+  if (s.tempCenti < -5000 || s.tempCenti > 10000)
+  {
+    return false;
+  }
+  return (s.hysteresisCenti >= 0) && (s.hysteresisCenti <= 1000);
+}
+
+/***************** Bit packing **************************************************
+ * Description:
+ * Delta stream per sample, MSB first:
+ *   1 bit   heaterOn
+ *   1 bit   tsSec irregular; if set: delta(ts - prevTs - intervalSec)
+ *   delta   tempCenti - prevTemp
+ *   1 bit   set point/hysteresis changed; if set: delta(sp), delta(hy)
+ * delta = zig-zag value in a prefix code:
+ *   0   + 2 bit  (0..3)       10  + 5 bit  (4..35)
+ *   110 + 9 bit  (36..547)    111 + 32 bit (rest)
+ * A steady 5-minute sample costs 6..10 bits instead of 96. Timestamp deltas
+ * use uint32 wrap-around, so NTP jumps (uptime -> epoch) encode exactly.
+ ******************************************************************************/
+static bool putBits(uint8_t* buf, uint32_t& pos, uint32_t v, uint8_t n)
+{
+  if (pos + n > HIST_PAYLOAD_BITS)
+  {
+    return false;
+  }
+  while (n--)
+  {
+    const uint8_t mask = 0x80 >> (pos & 7);
+    if ((v >> n) & 1)
+    {
+      buf[pos >> 3] |= mask;
+    }
+    else
+    {
+      buf[pos >> 3] &= ~mask;
+    }
+    pos++;
+  }
+  return true;
+}
+
+static bool getBits(const uint8_t* buf, uint32_t endBits, uint32_t& pos, uint8_t n, uint32_t& v)
+{
+  if (pos + n > endBits)
+  {
+    return false;
+  }
+  v = 0;
+  while (n--)
+  {
+    v = (v << 1) | ((buf[pos >> 3] >> (7 - (pos & 7))) & 1);
+    pos++;
+  }
+  return true;
+}
+
+static bool putDelta(uint8_t* buf, uint32_t& pos, int32_t d)
+{
+  const uint32_t zz = ((uint32_t)d << 1) ^ (uint32_t)(d >> 31);
+  if (zz < 4)
+  {
+    return putBits(buf, pos, 0x0, 1) && putBits(buf, pos, zz, 2);
+  }
+  if (zz < 36)
+  {
+    return putBits(buf, pos, 0x2, 2) && putBits(buf, pos, zz - 4, 5);
+  }
+  if (zz < 548)
+  {
+    return putBits(buf, pos, 0x6, 3) && putBits(buf, pos, zz - 36, 9);
+  }
+  return putBits(buf, pos, 0x7, 3) && putBits(buf, pos, zz, 32);
+}
+
+static bool getDelta(const uint8_t* buf, uint32_t endBits, uint32_t& pos, int32_t& d)
+{
+  uint32_t b = 0;
+  uint32_t zz = 0;
+  uint8_t  prefix = 0;
+
+  // Präfix: bis zu drei Einsen
+  while (prefix < 3)
+  {
+    if (!getBits(buf, endBits, pos, 1, b))
+    {
+      return false;
+    }
+    if (b == 0)
+    {
+      break;
+    }
+    prefix++;
+  }
+
+  static const uint8_t  WIDTH[4]  = { 2, 5, 9, 32 };
+  static const uint32_t OFFSET[4] = { 0, 4, 36, 0 };
+  if (!getBits(buf, endBits, pos, WIDTH[prefix], zz))
+  {
+    return false;
+  }
+  zz += OFFSET[prefix];
+  d = (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+  return true;
+}
+
+/***************** encodeSample *************************************************
+ * params: s, pos
+ * return: bool
+ * Description:
+ * Appends s as delta to openLast at bit position pos of the open block.
+ * Returns false (pos undefined) if the block has no room left.
+ ******************************************************************************/
+static bool encodeSample(const LogSample& s, uint32_t& pos)
+{
+  const int32_t dTs = (int32_t)(s.tsSec - openLast.tsSec - openHdr.intervalSec);
+  const bool spChanged = s.setPointCenti != openLast.setPointCenti ||
+                         s.hysteresisCenti != openLast.hysteresisCenti;
+
+  return putBits(openBits, pos, s.flags & 0x01, 1) &&
+         putBits(openBits, pos, dTs != 0 ? 1 : 0, 1) &&
+         (dTs == 0 || putDelta(openBits, pos, dTs)) &&
+         putDelta(openBits, pos, (int32_t)s.tempCenti - openLast.tempCenti) &&
+         putBits(openBits, pos, spChanged ? 1 : 0, 1) &&
+         (!spChanged || (putDelta(openBits, pos, (int32_t)s.setPointCenti - openLast.setPointCenti) &&
+                         putDelta(openBits, pos, (int32_t)s.hysteresisCenti - openLast.hysteresisCenti)));
+}
+
+/***************** decodeSample *************************************************
+ * params: buf, bh, pos, s
+ * return: bool
+ * Description:
+ * Decodes the sample following s (in place) from the delta stream.
+ ******************************************************************************/
+static bool decodeSample(const uint8_t* buf, const BlockHeader& bh, uint32_t& pos, LogSample& s)
+{
+  uint32_t heater = 0;
+  uint32_t irregular = 0;
+  uint32_t spChanged = 0;
+  int32_t  d = 0;
+
+  if (!getBits(buf, bh.bits, pos, 1, heater) || !getBits(buf, bh.bits, pos, 1, irregular))
+  {
+    return false;
+  }
+  s.tsSec += bh.intervalSec;
+  if (irregular)
+  {
+    if (!getDelta(buf, bh.bits, pos, d))
+    {
+      return false;
+    }
+    s.tsSec += (uint32_t)d;
+  }
+  if (!getDelta(buf, bh.bits, pos, d))
+  {
+    return false;
+  }
+  s.tempCenti = (int16_t)(s.tempCenti + d);
+  if (!getBits(buf, bh.bits, pos, 1, spChanged))
+  {
+    return false;
+  }
+  if (spChanged)
+  {
+    if (!getDelta(buf, bh.bits, pos, d))
+    {
+      return false;
+    }
+    s.setPointCenti = (int16_t)(s.setPointCenti + d);
+    if (!getDelta(buf, bh.bits, pos, d))
+    {
+      return false;
+    }
+    s.hysteresisCenti = (int16_t)(s.hysteresisCenti + d);
+  }
+  s.flags = heater ? 0x01 : 0x00;
+  return true;
+}
+
+/***************** readBlockHeader **********************************************
+ * params: idx, bh
+ * return: bool
+ * Description:
+ * Liest einen Blockkopf; der offene Block kommt aus dem RAM.
+ ******************************************************************************/
+static bool readBlockHeader(uint32_t idx, BlockHeader& bh)
+{
+  if (idx == hdr.head)
+  {
+    bh = openHdr;
+    return true;
+  }
+  histFile.seek(blockOffset(idx), SeekSet);
+  return histFile.read((uint8_t*)&bh, sizeof(bh)) == sizeof(bh);
+}
+
+/***************** startBlock ***************************************************
+ * params: s
+ * return: void
+ * Description:
+ * Macht s zum Basis-Sample des (leeren) offenen Blocks.
+ ******************************************************************************/
+static void startBlock(const LogSample& s)
+{
+  memset(&openHdr, 0, sizeof(openHdr));
+  openHdr.firstSeq    = hdr.seq;
+  openHdr.keyTs       = (s.tsSec >= HIST_EPOCH_MIN) ? s.tsSec : UINT32_MAX;
+  openHdr.count       = 1;
+  openHdr.bits        = 0;
+  openHdr.intervalSec = (uint16_t)(LOG_INTERVAL_MINUTES * 60UL);
+  openHdr.base        = s;
+  openHdr.base.seq    = (uint8_t)hdr.seq;
+  openLast            = openHdr.base;
+
+  BlockHeader prev;
+  if (hdr.blocks > 1 && readBlockHeader((hdr.head + hdr.capacity - 1) % hdr.capacity, prev) &&
+      prev.count > 0)
+  {
+    if (prev.keyTs != UINT32_MAX)
+    {
+      openHdr.keyBack = 1;
+    }
+    else if (prev.keyBack > 0 && prev.keyBack < UINT16_MAX)
+    {
+      openHdr.keyBack = prev.keyBack + 1;
+    }
+  }
+}
+
+/***************** resetOpenBlock ***********************************************
+ * params: none
+ * return: void
+ * Description:
+ * Leerer offener Block, nächstes Sample wird Basis.
+ ******************************************************************************/
+static void resetOpenBlock()
+{
+  memset(&openHdr, 0, sizeof(openHdr));
+  openHdr.firstSeq = hdr.seq;
+  openHdr.keyTs    = UINT32_MAX;
+  dec.valid        = false;
+}
+
+/***************** writeOpenBlock ***********************************************
  * params: none
  * return: bool
  * Description:
- * Always recreates the history file on startup. Old data is discarded.
- * Creates a fresh file with header and full allocated size.
+ * Writes header and used part of the open block (one seek, one write each).
  ******************************************************************************/
-static bool fileOpenOrCreate()
+static bool writeOpenBlock()
 {
-    if (!LittleFS.begin())
+  const size_t payload = ((size_t)openHdr.bits + 7) / 8;
+  histFile.seek(blockOffset(hdr.head), SeekSet);
+  return histFile.write((const uint8_t*)&openHdr, sizeof(openHdr)) == sizeof(openHdr) &&
+         histFile.write(openBits, payload) == payload;
+}
+
+/***************** advanceBlock *************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Moves head to the next block. Once the ring is full the oldest block is
+ * reused and oldestSeq moves to the block after it.
+ ******************************************************************************/
+static bool advanceBlock()
+{
+  const uint32_t next = (hdr.head + 1) % hdr.capacity;
+
+  if (hdr.blocks >= hdr.capacity)
+  {
+    BlockHeader bh;
+    const uint32_t after = (next + 1) % hdr.capacity;
+    if (!readBlockHeader(after, bh))
     {
-        Serial.println(F("[HIST] LittleFS mount failed"));
-        return false;
+      return false;
+    }
+    oldestSeq = bh.firstSeq;
+  }
+  else
+  {
+    hdr.blocks++;
+  }
+
+  hdr.head = next;
+  resetOpenBlock();
+  return true;
+}
+
+/***************** storeSample **************************************************
+ * params: s
+ * return: bool
+ * Description:
+ * Encodes one sample into the open block; a full block is written out and
+ * the sample becomes the base of the next one. Advances hdr.seq.
+ ******************************************************************************/
+static bool storeSample(const LogSample& s)
+{
+  if (openHdr.count > 0)
+  {
+    uint32_t pos = openHdr.bits;
+    if (encodeSample(s, pos))
+    {
+      openHdr.bits = (uint16_t)pos;
+      openHdr.count++;
+      if (openHdr.keyTs == UINT32_MAX && s.tsSec >= HIST_EPOCH_MIN)
+      {
+        openHdr.keyTs = s.tsSec;
+      }
+      openLast = s;
+      hdr.seq++;
+      return true;
+    }
+
+    // Block voll: abschließen und nächsten öffnen
+    if (!writeOpenBlock() || !advanceBlock())
+    {
+      return false;
+    }
+  }
+
+  startBlock(s);
+  hdr.seq++;
+  return true;
+}
+
+/***************** writeHeader **************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Persistiert den Dateikopf und schließt den Schreibvorgang ab.
+ ******************************************************************************/
+static void writeHeader()
+{
+  histFile.seek(0, SeekSet);
+  histFile.write((const uint8_t*)&hdr, sizeof(hdr));
+  histFile.flush();
+}
+
+/***************** createFresh **************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Deletes any existing file and creates a fresh one with header and full
+ * allocated size (HISTORY_FILE_BYTES). Only used when no valid file can be
+ * resumed or migrated.
+ ******************************************************************************/
+static bool createFresh()
+{
+    const unsigned long t0 = millis();
+
+    if (histFile)
+    {
+        histFile.close();
     }
 
-    // Always delete on startup
     if (LittleFS.exists(HISTORY_FILE_PATH))
     {
         LittleFS.remove(HISTORY_FILE_PATH);
         Serial.println(F("[HIST] Removed old history file"));
     }
 
-    // Create new file
-    histFile = LittleFS.open(HISTORY_FILE_PATH, "w+");
-    if (!histFile)
+    // Create new file
+    histFile = LittleFS.open(HISTORY_FILE_PATH, "w+");
+    if (!histFile)
+    {
+        Serial.println(F("[HIST] Create file failed"));
+        return false;
+    }
+
+    hdr.magic     = HIST_MAGIC;
+    hdr.version   = HIST_VERSION;
+    hdr.blockSize = HISTORY_BLOCK_BYTES;
+    hdr.capacity  = HIST_CAPACITY_BLOCKS;
+    hdr.head      = 0;
+    hdr.blocks    = 1;
+    hdr.seq       = 0;
+    oldestSeq     = 0;
+    resetOpenBlock();
+
+    // Write header
+    histFile.seek(0, SeekSet);
+    histFile.write((const uint8_t*)&hdr, sizeof(hdr));
+
+    // Pre-allocate entire file (header + blocks)
+    const size_t total = blockOffset(hdr.capacity);
+    histFile.seek(total - 1, SeekSet);
+    histFile.write((const uint8_t*)"\0", 1);
+    histFile.flush();
+
+    Serial.printf("[HIST] Created fresh %s blocks=%lu x %u B in %lu ms\n",
+                  HISTORY_FILE_PATH, (unsigned long)hdr.capacity, (unsigned)hdr.blockSize,
+                  millis() - t0);
+
+    return true;
+}
+
+/***************** rollForward **************************************************
+ * params: none
+ * return: uint32_t (samples recovered)
+ * Description:
+ * The header may lag behind the blocks if power was lost between writing a
+ * block and persisting the header. The head block's own count is
+ * authoritative, and a following block whose firstSeq continues the chain
+ * was opened after the last header update.
+ ******************************************************************************/
+static uint32_t rollForward()
+{
+  const uint32_t seq0 = hdr.seq;
+  BlockHeader bh;
+
+  histFile.seek(blockOffset(hdr.head), SeekSet);
+  if (histFile.read((uint8_t*)&bh, sizeof(bh)) != sizeof(bh) || bh.count == 0)
+  {
+    return 0;
+  }
+  if ((int32_t)(bh.firstSeq + bh.count - hdr.seq) > 0)
+  {
+    hdr.seq = bh.firstSeq + bh.count;
+  }
+
+  for (uint32_t n = 0; n < hdr.capacity; n++)
+  {
+    const uint32_t next = (hdr.head + 1) % hdr.capacity;
+    histFile.seek(blockOffset(next), SeekSet);
+    if (histFile.read((uint8_t*)&bh, sizeof(bh)) != sizeof(bh) ||
+        bh.count == 0 || bh.firstSeq != hdr.seq)
+    {
+      break;
+    }
+    hdr.head = next;
+    if (hdr.blocks < hdr.capacity)
+    {
+      hdr.blocks++;
+    }
+    hdr.seq = bh.firstSeq + bh.count;
+  }
+  return hdr.seq - seq0;
+}
+
+/***************** rescanRing ***************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Rebuilds head/blocks/seq from the block headers alone when the file header
+ * is inconsistent: the newest block is the one with the highest sequence,
+ * older blocks are collected backwards while their firstSeq chain holds.
+ ******************************************************************************/
+static bool rescanRing()
+{
+  const uint32_t cap = hdr.capacity;
+  BlockHeader bh;
+  bool found = false;
+  uint32_t newestIdx = 0;
+  uint32_t newestEnd = 0;
+
+  for (uint32_t i = 0; i < cap; i++)
+  {
+    histFile.seek(blockOffset(i), SeekSet);
+    if (histFile.read((uint8_t*)&bh, sizeof(bh)) != sizeof(bh))
+    {
+      return false;
+    }
+    if (bh.count > 0 && (!found || (int32_t)(bh.firstSeq + bh.count - newestEnd) > 0))
+    {
+      found     = true;
+      newestIdx = i;
+      newestEnd = bh.firstSeq + bh.count;
+    }
+    if ((i & 0x3F) == 0)
+    {
+      yield();
+    }
+  }
+
+  hdr.head   = found ? newestIdx : 0;
+  hdr.blocks = 1;
+  hdr.seq    = found ? newestEnd : 0;
+  if (!found)
+  {
+    return true;
+  }
+
+  // rückwärts, solange die Kette lückenlos ist
+  histFile.seek(blockOffset(newestIdx), SeekSet);
+  histFile.read((uint8_t*)&bh, sizeof(bh));
+  uint32_t expectEnd = bh.firstSeq;
+  while (hdr.blocks < cap)
+  {
+    const uint32_t prev = (hdr.head + cap - hdr.blocks) % cap;
+    histFile.seek(blockOffset(prev), SeekSet);
+    if (histFile.read((uint8_t*)&bh, sizeof(bh)) != sizeof(bh) ||
+        bh.count == 0 || bh.firstSeq + bh.count != expectEnd)
+    {
+      break;
+    }
+    expectEnd = bh.firstSeq;
+    hdr.blocks++;
+  }
+  return true;
+}
+
+/***************** loadOpenBlock ************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Reads the head block into RAM and decodes it to its last sample, which
+ * is the delta base for the next append. Also sets oldestSeq.
+ ******************************************************************************/
+static bool loadOpenBlock()
+{
+  BlockHeader bh;
+  histFile.seek(blockOffset(hdr.head), SeekSet);
+  if (histFile.read((uint8_t*)&bh, sizeof(bh)) != sizeof(bh))
+  {
+    return false;
+  }
+
+  if (bh.count == 0)
+  {
+    resetOpenBlock();
+  }
+  else
+  {
+    if (bh.firstSeq + bh.count != hdr.seq || bh.bits > HIST_PAYLOAD_BITS)
+    {
+      return false;
+    }
+    const size_t payload = ((size_t)bh.bits + 7) / 8;
+    if (histFile.read(openBits, payload) != payload)
+    {
+      return false;
+    }
+
+    openHdr  = bh;
+    openLast = bh.base;
+    uint32_t pos = 0;
+    for (uint32_t i = 1; i < bh.count; i++)
+    {
+      if (!decodeSample(openBits, bh, pos, openLast))
+      {
+        return false;
+      }
+    }
+    if (pos != bh.bits)
+    {
+      return false;
+    }
+    dec.valid = false;
+  }
+
+  // ältester Block bestimmt den Anfang des Rings
+  BlockHeader oldest;
+  if (!readBlockHeader(blockAt(0), oldest))
+  {
+    return false;
+  }
+  oldestSeq = (oldest.count > 0) ? oldest.firstSeq : hdr.seq;
+  return (int32_t)(hdr.seq - oldestSeq) >= 0;
+}
+
+/***************** openExisting *************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Opens and validates an existing history file. Returns false if the file is
+ * missing or structurally incompatible (caller migrates or re-creates it).
+ ******************************************************************************/
+static bool openExisting()
+{
+  const unsigned long t0 = millis();
+
+  if (!LittleFS.exists(HISTORY_FILE_PATH))
+  {
+    return false;
+  }
+
+  histFile = LittleFS.open(HISTORY_FILE_PATH, "r+");
+  if (!histFile)
+  {
+    Serial.println(F("[HIST] Open existing file failed"));
+    return false;
+  }
+
+  HistoryHeader h;
+  histFile.seek(0, SeekSet);
+  if (histFile.read((uint8_t*)&h, sizeof(h)) != sizeof(h))
+  {
+    Serial.println(F("[HIST] Header unreadable"));
+    histFile.close();
+    return false;
+  }
+
+  const size_t expected = sizeof(h) + (size_t)HIST_CAPACITY_BLOCKS * HISTORY_BLOCK_BYTES;
+  if (h.magic != HIST_MAGIC || h.version != HIST_VERSION ||
+      h.blockSize != HISTORY_BLOCK_BYTES || h.capacity != HIST_CAPACITY_BLOCKS ||
+      histFile.size() < expected)
+  {
+    Serial.println(F("[HIST] Header mismatch (magic/version/size)"));
+    histFile.close();
+    return false;
+  }
+
+  hdr = h;
+
+  const bool consistent = (hdr.head < hdr.capacity) && (hdr.blocks >= 1) &&
+                          (hdr.blocks <= hdr.capacity);
+  uint32_t recovered = 0;
+
+  if (consistent)
+  {
+    recovered = rollForward();
+  }
+
+  if (!consistent || !loadOpenBlock())
+  {
+    Serial.println(F("[HIST] Header inconsistent, rescanning ring"));
+    if (!rescanRing() || !loadOpenBlock())
+    {
+      Serial.println(F("[HIST] Rescan failed"));
+      histFile.close();
+      return false;
+    }
+    recovered = hdr.seq - oldestSeq;
+  }
+
+  if (recovered > 0 || !consistent)
+  {
+    writeHeader();
+  }
+
+  const uint32_t count = hdr.seq - oldestSeq;
+  Serial.printf("[HIST] Resumed %s count=%lu blocks=%lu/%lu (recovered %lu) in %lu ms\n",
+                HISTORY_FILE_PATH, (unsigned long)count, (unsigned long)hdr.blocks,
+                (unsigned long)hdr.capacity, (unsigned long)recovered, millis() - t0);
+  return true;
+}
+
+/***************** migrateV4 ****************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Converts a version 4 file (flat ring of 12-byte records) into the block
+ * format. The old file is renamed aside, its records are re-encoded oldest
+ * first and it is removed afterwards. Returns false if there is no v4 file.
+ ******************************************************************************/
+static bool migrateV4()
+{
+  const unsigned long t0 = millis();
+  static const char* V4_PATH = HISTORY_FILE_PATH ".v4";
+
+  File old = LittleFS.open(HISTORY_FILE_PATH, "r");
+  if (!old)
+  {
+    return false;
+  }
+
+  HistoryHeader h;  // v4: blockSize = recSize, capacity = Records, blocks = count
+  const bool isV4 = old.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+                    h.magic == HIST_MAGIC && h.version == HIST_VERSION_V4 &&
+                    h.blockSize == sizeof(LogSample) && h.capacity > 0 &&
+                    h.head < h.capacity && h.blocks <= h.capacity;
+  old.close();
+  if (!isV4)
+  {
+    return false;
+  }
+
+  LittleFS.remove(V4_PATH);
+  if (!LittleFS.rename(HISTORY_FILE_PATH, V4_PATH) || !createFresh())
+  {
+    Serial.println(F("[HIST] Migration failed, dropping v4 data"));
+    LittleFS.remove(V4_PATH);
+    return false;
+  }
+
+  old = LittleFS.open(V4_PATH, "r");
+  uint32_t migrated = 0;
+  uint32_t done = 0;
+  bool ok = (bool)old;
+  LogSample buf[16];
+
+  while (ok && done < h.blocks)
+  {
+    const uint32_t idx = (h.head + h.capacity - h.blocks + done) % h.capacity;
+    uint32_t run = h.blocks - done;
+    if (run > 16)                 run = 16;
+    if (run > h.capacity - idx)   run = h.capacity - idx;
+
+    old.seek(sizeof(h) + (size_t)idx * sizeof(LogSample), SeekSet);
+    ok = old.read((uint8_t*)buf, run * sizeof(LogSample)) == run * sizeof(LogSample);
+    for (uint32_t i = 0; ok && i < run; i++)
+    {
+      if (isPlausibleSample(buf[i]))
+      {
+        ok = storeSample(buf[i]);
+        migrated++;
+      }
+    }
+    done += run;
+    yield();
+  }
+  if (old)
+  {
+    old.close();
+  }
+
+  if (ok && openHdr.count > 0)
+  {
+    ok = writeOpenBlock();
+  }
+  writeHeader();
+  LittleFS.remove(V4_PATH);
+
+  Serial.printf("[HIST] Migrated %lu v4 samples into %lu blocks in %lu ms%s\n",
+                (unsigned long)migrated, (unsigned long)hdr.blocks, millis() - t0,
+                ok ? "" : " (incomplete)");
+  return ok || createFresh();
+}
+
+/***************** fileOpenOrCreate ********************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Resumes the existing ring buffer if its header validates; converts a v4
+ * file; only falls back to a fresh file on real corruption or a geometry
+ * change.
+ ******************************************************************************/
+static bool fileOpenOrCreate()
+{
+    if (!LittleFS.begin())
+    {
+        Serial.println(F("[HIST] LittleFS mount failed"));
+        return false;
+    }
+
+    if (openExisting() || migrateV4())
     {
-        Serial.println(F("[HIST] Create file failed"));
-        return false;
+        return true;
     }
 
-    hdr.magic    = HIST_MAGIC;
-    hdr.version  = HIST_VERSION;
-    hdr.recSize  = sizeof(LogSample);
-    hdr.capacity = HISTORY_CAPACITY_RECORDS;
-    hdr.head     = 0;
-    hdr.count    = 0;
-    hdr.reserved = 0;
+    return createFresh();
+}
 
-    // Write header
-    histFile.seek(0, SeekSet);
-    histFile.write((const uint8_t*)&hdr, sizeof(hdr));
+#ifdef HISTORY_BENCH
+/***************** benchHistoryRead *********************************************
+ * params: none
+ * return: void
+ * Description:
+ * Reads the last 14 days (or the whole ring) twice and logs records/s:
+ * through one cursor in chunks of 32, and per record as a caller without a
+ * cursor would do it (openHistoryRange() on the sample's timestamp, i.e.
+ * binary search plus block decode, then read one). Only the lookups are
+ * timed in the second pass. Also logs the effective flash cost per sample.
+ * Build with -DHISTORY_BENCH.
+ ******************************************************************************/
+static void benchHistoryRead()
+{
+  static LogSample buf[32];
+  const uint32_t want = (14UL * 24UL * 60UL) / (LOG_INTERVAL_MINUTES > 0 ? LOG_INTERVAL_MINUTES : 1);
+  const uint32_t count = hdr.seq - oldestSeq;
+  if (count == 0)
+  {
+    Serial.println(F("[HIST] Bench skipped (empty ring)"));
+    return;
+  }
 
-    // Pre-allocate entire file (header + data)
-    const size_t total = sizeof(hdr) + (size_t)hdr.capacity * hdr.recSize;
-    histFile.seek(total - 1, SeekSet);
-    histFile.write((const uint8_t*)"\0", 1);
-    histFile.flush();
+  HistoryCursor c;
+  uint32_t t0 = micros();
+  openHistoryTail(c, want);
+  uint32_t got = 0;
+  size_t r;
+  while ((r = readHistoryCursor(c, buf, 32)) > 0)
+  {
+    got += r;
+  }
+  const uint32_t newUs = micros() - t0;
 
-    Serial.print(F("[HIST] Created fresh "));
-    Serial.print(HISTORY_FILE_PATH);
-    Serial.print(F(" capacity="));
-    Serial.println(hdr.capacity);
+  // gleiche Records, jeder über eine eigene Zeitabfrage
+  uint32_t oldUs  = 0;
+  uint32_t gotOld = 0;
+  openHistoryTail(c, want);
+  while ((r = readHistoryCursor(c, buf, 32)) > 0)
+  {
+    for (size_t i = 0; i < r; i++)
+    {
+      t0 = micros();
+      HistoryCursor one;
+      LogSample     rec;
+      if (openHistoryRange(one, buf[i].tsSec, buf[i].tsSec) > 0)
+      {
+        gotOld += readHistoryCursor(one, &rec, 1);
+      }
+      oldUs += micros() - t0;
+    }
+  }
 
-    return true;
+  const uint32_t usedBytes = hdr.blocks * hdr.blockSize;
+  Serial.printf("[HIST] Bench %lu records: per-record %lu rec/s, cursor %lu rec/s (x%lu)\n",
+                (unsigned long)got,
+                (unsigned long)((uint64_t)gotOld * 1000000ULL / (oldUs ? oldUs : 1)),
+                (unsigned long)((uint64_t)got * 1000000ULL / (newUs ? newUs : 1)),
+                (unsigned long)(oldUs / (newUs ? newUs : 1)));
+  Serial.printf("[HIST] Bench %lu.%02lu B/sample on flash (v4: 12)\n",
+                (unsigned long)(usedBytes / count),
+                (unsigned long)((usedBytes % count) * 100UL / count));
 }
+#endif
 
-/***************** recOffset ****************************************************
- * params: idx
- * return: size_t
+/***************** initHistory **************************************************
+ * params: none
+ * return: bool
  * Description:
- * Byte-Offset eines Records in der Datei.
+ * Mountet FS und initialisiert/öffnet den Ringpuffer.
  ******************************************************************************/
-static inline size_t recOffset(uint32_t idx)
+bool initHistory()
 {
-  return sizeof(hdr) + (size_t)idx * hdr.recSize;
+  const bool ok = fileOpenOrCreate();
+  if (ok)
+  {
+    initRollups();
+  }
+#ifdef HISTORY_BENCH
+  if (ok)
+  {
+    benchHistoryRead();
+  }
+#endif
+  return ok;
 }
 
-/***************** initHistory **************************************************
+/***************** flushHistory *************************************************
  * params: none
  * return: bool
  * Description:
- * Mountet FS und initialisiert/öffnet den Ringpuffer.
+ * Commits all staged samples: encodes them into the open block (writing out
+ * blocks that fill up), then writes the open block, the header and one
+ * flush. On a write error the RAM state is rolled back and the samples
+ * stay staged.
  ******************************************************************************/
-bool initHistory()
+bool flushHistory()
 {
-  return fileOpenOrCreate();
+  if (stageCount == 0)
+  {
+    return true;
+  }
+  if (!histFile)
+  {
+    return false;
+  }
+
+  const uint32_t t0 = micros();
+  const uint32_t n  = stageCount;
+
+  // Zustand sichern, um bei Schreibfehlern zurückrollen zu können
+  const HistoryHeader hdr0    = hdr;
+  const BlockHeader   open0   = openHdr;
+  const LogSample     last0   = openLast;
+  const uint32_t      oldest0 = oldestSeq;
+  uint8_t             bits0[HIST_PAYLOAD_BYTES];
+  memcpy(bits0, openBits, sizeof(bits0));
+
+  bool ok = true;
+  for (uint32_t i = 0; ok && i < n; i++)
+  {
+    ok = storeSample(stage[i]);
+  }
+  ok = ok && writeOpenBlock();
+  dec.valid = false;
+
+  if (!ok)
+  {
+    hdr       = hdr0;
+    openHdr   = open0;
+    openLast  = last0;
+    oldestSeq = oldest0;
+    memcpy(openBits, bits0, sizeof(bits0));
+    histStats.flushErrors++;
+    Serial.println(F("[HIST] Write staged samples failed"));
+    return false;
+  }
+
+  stageCount = 0;
+  writeHeader();
+
+  const uint32_t dt = micros() - t0;
+  histStats.flushes++;
+  histStats.flushedRecords += n;
+  histStats.lastFlushUs   = dt;
+  histStats.totalFlushUs += dt;
+  if (dt > histStats.maxFlushUs)
+  {
+    histStats.maxFlushUs = dt;
+  }
+
+  Serial.printf("[HIST] Flushed %lu samples in %lu us (%lu us/sample)\n",
+                (unsigned long)n, (unsigned long)dt, (unsigned long)(dt / n));
+  return true;
 }
 
 /***************** appendHistory ************************************************
  * params: sample
  * return: bool
  * Description:
- * Schreibt einen Datensatz an hdr.head, inkrementiert Head/Count und persistiert.
+ * Stages a sample in RAM and stamps the low byte of its sequence number.
+ * Flushes once HISTORY_STAGE_RECORDS are pending; age-based flushing happens
+ * in handleHistory().
  ******************************************************************************/
-bool appendHistory(const LogSample& s)
+bool appendHistory(const LogSample& sample)
 {
   if (!histFile)
   {
     return false;
   }
 
-  const size_t off = recOffset(hdr.head);
-  histFile.seek(off, SeekSet);
-  const size_t w = histFile.write((const uint8_t*)&s, sizeof(s));
-  if (w != sizeof(s))
+  const uint32_t t0 = micros();
+
+  if (stageCount >= HISTORY_STAGE_RECORDS && !flushHistory())
   {
-    Serial.println(F("[HIST] Write sample failed"));
-    return false;
+    // Flash nicht beschreibbar: ältestes Sample verwerfen statt zu blockieren
+    memmove(&stage[0], &stage[1], (HISTORY_STAGE_RECORDS - 1) * sizeof(LogSample));
+    stageCount--;
   }
 
-  // Head vorrücken
-  hdr.head = (hdr.head + 1) % hdr.capacity;
-  if (hdr.count < hdr.capacity)
+  if (stageCount == 0)
   {
-    hdr.count++;
+    stageSinceMs = millis();
   }
 
-  // Header persistieren
-  histFile.seek(0, SeekSet);
-  histFile.write((const uint8_t*)&hdr, sizeof(hdr));
-  histFile.flush();
+  LogSample& s = stage[stageCount];
+  s = sample;
+  s.seq = (uint8_t)(hdr.seq + stageCount);
+  stageCount++;
+
+  // Sample ist gestagt: ein Fehler beim Schreiben zählt flushHistory() in
+  // flushErrors, die Samples bleiben für den nächsten Versuch im Puffer
+  if (stageCount >= HISTORY_STAGE_RECORDS)
+  {
+    flushHistory();
+  }
+
+  const uint32_t dt = micros() - t0;
+  histStats.appends++;
+  histStats.lastAppendUs = dt;
+  histStats.totalAppendUs += dt;
+  if (dt > histStats.maxAppendUs)
+  {
+    histStats.maxAppendUs = dt;
+  }
   return true;
 }
 
@@ -144,15 +1082,429 @@ bool appendHistory(uint32_t tsSec, int16_t tempCenti, bool heaterOn)
   s.setPointCenti   = (int16_t)roundf(getSetPoint() * 100.0f);
   s.hysteresisCenti = (int16_t)roundf(getHysteresis() * 100.0f);
   s.flags           = heaterOn ? 0x01 : 0x00;
-  s.rsv             = 0;
+  s.seq             = 0;
   return appendHistory(s);
 }
 
+/***************** loadBlock ****************************************************
+ * params: idx
+ * return: bool
+ * Description:
+ * Puts the decoder on the base sample of block idx.
+ ******************************************************************************/
+static bool loadBlock(uint32_t idx)
+{
+  dec.valid = false;
+  if (idx == hdr.head)
+  {
+    dec.bh = openHdr;
+    memcpy(dec.bits, openBits, ((size_t)openHdr.bits + 7) / 8);
+  }
+  else
+  {
+    histFile.seek(blockOffset(idx), SeekSet);
+    if (histFile.read((uint8_t*)&dec.bh, sizeof(dec.bh)) != sizeof(dec.bh) ||
+        dec.bh.bits > HIST_PAYLOAD_BITS)
+    {
+      return false;
+    }
+    const size_t payload = ((size_t)dec.bh.bits + 7) / 8;
+    if (histFile.read(dec.bits, payload) != payload)
+    {
+      return false;
+    }
+  }
+  if (dec.bh.count == 0)
+  {
+    return false;
+  }
+
+  dec.idx   = idx;
+  dec.pos   = 0;
+  dec.seq   = dec.bh.firstSeq;
+  dec.cur   = dec.bh.base;
+  dec.valid = true;
+  return true;
+}
+
+/***************** findBlock ****************************************************
+ * params: seq
+ * return: uint32_t
+ * Description:
+ * Blockindex, der seq enthält: Binärsuche über die firstSeq der Blockköpfe.
+ ******************************************************************************/
+static uint32_t findBlock(uint32_t seq)
+{
+  uint32_t lo = 0;
+  uint32_t hi = hdr.blocks - 1;
+  BlockHeader bh;
+
+  while (lo < hi)
+  {
+    const uint32_t mid = lo + (hi - lo + 1) / 2;
+    if (readBlockHeader(blockAt(mid), bh) && (int32_t)(bh.firstSeq - seq) <= 0)
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid - 1;
+    }
+  }
+  return blockAt(lo);
+}
+
+/***************** seekDecoder **************************************************
+ * params: seq
+ * return: bool
+ * Description:
+ * Moves the decoder to flushed sample seq. Forward reads stay inside the
+ * cached block or step into the following one; anything else is located
+ * via findBlock().
+ ******************************************************************************/
+static bool seekDecoder(uint32_t seq)
+{
+  const bool inBlock = dec.valid && (int32_t)(seq - dec.seq) >= 0 &&
+                       seq - dec.bh.firstSeq < dec.bh.count;
+  if (!inBlock)
+  {
+    const bool nextBlock = dec.valid && seq == dec.bh.firstSeq + dec.bh.count;
+    const uint32_t idx = nextBlock ? (dec.idx + 1) % hdr.capacity : findBlock(seq);
+    if (!loadBlock(idx) || (int32_t)(seq - dec.seq) < 0 || seq - dec.bh.firstSeq >= dec.bh.count)
+    {
+      dec.valid = false;
+      return false;
+    }
+  }
+
+  while (dec.seq != seq)
+  {
+    if (!decodeSample(dec.bits, dec.bh, dec.pos, dec.cur))
+    {
+      dec.valid = false;
+      return false;
+    }
+    dec.seq++;
+  }
+  dec.cur.seq = (uint8_t)dec.seq;
+  return true;
+}
+
+/***************** openHistoryTail **********************************************
+ * params: c, maxRecords
+ * return: size_t
+ * Description:
+ * Positions the cursor on the oldest of the last maxRecords samples.
+ * Returns the number of samples the cursor will deliver.
+ ******************************************************************************/
+size_t openHistoryTail(HistoryCursor& c, size_t maxRecords)
+{
+  const uint32_t endSeq = hdr.seq + stageCount;
+  const uint32_t total  = histFile ? endSeq - oldestSeq : 0;
+  const uint32_t n      = (total < maxRecords) ? total : (uint32_t)maxRecords;
+
+  c.nextSeq = endSeq - n;
+  c.endSeq  = endSeq;
+  return n;
+}
+
+/***************** openHistoryFrom **********************************************
+ * params: c, seq
+ * return: size_t
+ * Description:
+ * Positions the cursor on sample seq (clamped to what is still stored) up to
+ * the newest one. Returns the number of samples the cursor will deliver.
+ ******************************************************************************/
+size_t openHistoryFrom(HistoryCursor& c, uint32_t seq)
+{
+  const uint32_t endSeq = hdr.seq + stageCount;
+  const uint32_t oldest = histFile ? oldestSeq : endSeq;
+
+  if ((int32_t)(seq - oldest) < 0)
+  {
+    seq = oldest;   // Lücke: Ringpuffer hat inzwischen überschrieben
+  }
+  if ((int32_t)(endSeq - seq) < 0)
+  {
+    seq = endSeq;   // Cursor aus der Zukunft (Datei neu angelegt)
+  }
+
+  c.nextSeq = seq;
+  c.endSeq  = endSeq;
+  return endSeq - seq;
+}
+
+/***************** readHistoryCursor ********************************************
+ * params: c, buf, maxCount
+ * return: size_t
+ * Description:
+ * Fills buf with up to maxCount samples (oldest first) and advances the
+ * cursor. Flushed samples are decoded block by block (each block is read
+ * once while reading forward), staged ones come straight from RAM. Samples
+ * overwritten since the cursor was opened are skipped. Returns 0 at the end.
+ ******************************************************************************/
+size_t readHistoryCursor(HistoryCursor& c, LogSample* buf, size_t maxCount)
+{
+  if (!histFile || buf == nullptr)
+  {
+    return 0;
+  }
+
+  if ((int32_t)(c.nextSeq - oldestSeq) < 0)
+  {
+    c.nextSeq = oldestSeq; // inzwischen überschrieben
+  }
+  if ((int32_t)(c.endSeq - c.nextSeq) <= 0)
+  {
+    return 0;
+  }
+
+  uint32_t want = c.endSeq - c.nextSeq;
+  if (want > maxCount)
+  {
+    want = (uint32_t)maxCount;
+  }
+
+  size_t got = 0;
+
+  // Teil 1: geschriebene Samples aus den Blöcken
+  while (got < want && (int32_t)(hdr.seq - c.nextSeq) > 0)
+  {
+    if (!seekDecoder(c.nextSeq))
+    {
+      Serial.println(F("[HIST] Read failed"));
+      c.nextSeq = c.endSeq;
+      return got;
+    }
+    buf[got++] = dec.cur;
+    c.nextSeq++;
+  }
+
+  // Teil 2: gestagte Records aus dem RAM
+  while (got < want && (int32_t)(c.nextSeq - hdr.seq) >= 0 &&
+         c.nextSeq - hdr.seq < stageCount)
+  {
+    buf[got++] = stage[c.nextSeq - hdr.seq];
+    c.nextSeq++;
+  }
+
+  return got;
+}
+
+/***************** blockKey *****************************************************
+ * params: i
+ * return: uint32_t
+ * Description:
+ * Sort key of block i for the binary search: its keyTs, for a block without
+ * epoch samples the keyTs of the last block before it that has one (via
+ * keyBack), 0 if there is none. Unlike keyTs alone this is monotonic over
+ * the ring, uptime runs included. An empty open block sorts last.
+ ******************************************************************************/
+static uint32_t blockKey(uint32_t i)
+{
+  BlockHeader bh;
+  if (!readBlockHeader(blockAt(i), bh) || bh.count == 0)
+  {
+    return UINT32_MAX;
+  }
+  if (bh.keyTs != UINT32_MAX)
+  {
+    return bh.keyTs;
+  }
+  if (bh.keyBack == 0 || bh.keyBack > i || !readBlockHeader(blockAt(i - bh.keyBack), bh) ||
+      bh.keyTs == UINT32_MAX)
+  {
+    return 0;
+  }
+  return bh.keyTs;
+}
+
+/***************** scanLowerBound ***********************************************
+ * params: c, ts, inRun, runStart, pos
+ * return: bool
+ * Description:
+ * Decodes c up to c.endSeq until the first sample whose time key is >= ts
+ * and returns its sequence in pos. inRun/runStart carry an open run of
+ * uptime samples across calls: such a run takes the key of the epoch
+ * sample after it, so a hit right behind it returns the start of the run.
+ ******************************************************************************/
+static bool scanLowerBound(HistoryCursor& c, uint32_t ts, bool& inRun, uint32_t& runStart,
+                           uint32_t& pos)
+{
+  LogSample buf[16];
+  size_t r;
+  while ((r = readHistoryCursor(c, buf, 16)) > 0)
+  {
+    const uint32_t first = c.nextSeq - r;
+    for (size_t i = 0; i < r; i++)
+    {
+      if (buf[i].tsSec < HIST_EPOCH_MIN)
+      {
+        if (!inRun)
+        {
+          inRun = true;
+          runStart = first + i;
+        }
+      }
+      else if (buf[i].tsSec >= ts)
+      {
+        pos = inRun ? runStart : first + i;
+        return true;
+      }
+      else
+      {
+        inRun = false;
+      }
+    }
+  }
+  return false;
+}
+
+/***************** lowerBoundTs *************************************************
+ * params: ts, lo, hi
+ * return: uint32_t
+ * Description:
+ * First sequence in [lo, hi) whose time key is >= ts (hi if none). Epoch
+ * timestamps are their own key. Samples logged before NTP sync carry
+ * uptime-based values (see getEpochOrUptimeSec()); they take the key of the
+ * next epoch sample, or sort after everything if there is none.
+ * A binary search over blockKey() finds the first block a whose key is
+ * >= ts; the exact position is then decoded from block a-1. If a-1 lies in
+ * a run of blocks without epoch samples, only the block in front of the run
+ * is decoded and the run itself is skipped, so a query never decodes more
+ * than about three blocks plus the staging buffer.
+ ******************************************************************************/
+static uint32_t lowerBoundTs(uint32_t ts, uint32_t lo, uint32_t hi)
+{
+  uint32_t a = 0;
+  uint32_t b = hdr.blocks;
+
+  while (a != b)
+  {
+    const uint32_t mid = a + (b - a) / 2;
+    if (blockKey(mid) < ts)
+    {
+      a = mid + 1;
+    }
+    else
+    {
+      b = mid;
+    }
+  }
+
+  HistoryCursor c;
+  c.nextSeq = lo;
+  c.endSeq  = hi;
+  bool inRun = false;
+  uint32_t runStart = hi;
+  uint32_t pos;
+  BlockHeader bh;
+
+  if (a > 0 && readBlockHeader(blockAt(a - 1), bh) && bh.count > 0)
+  {
+    if (bh.keyTs != UINT32_MAX)
+    {
+      if ((int32_t)(bh.firstSeq - lo) > 0)
+      {
+        c.nextSeq = bh.firstSeq;
+      }
+    }
+    else
+    {
+      // a-1 liegt in einem Uptime-Lauf: nur den Block davor dekodieren
+      const uint32_t runEnd = bh.firstSeq + bh.count;
+      inRun    = true;
+      runStart = lo;
+      if (bh.keyBack > 0 && bh.keyBack < a &&
+          readBlockHeader(blockAt(a - 1 - bh.keyBack), bh))
+      {
+        const uint32_t keyEnd = bh.firstSeq + bh.count;
+        inRun = false;
+        if ((int32_t)(bh.firstSeq - lo) > 0)
+        {
+          c.nextSeq = bh.firstSeq;
+        }
+        c.endSeq = keyEnd;
+        if (scanLowerBound(c, ts, inRun, runStart, pos))
+        {
+          return pos;
+        }
+        if (!inRun)
+        {
+          inRun    = true;
+          runStart = ((int32_t)(keyEnd - lo) > 0) ? keyEnd : lo;
+        }
+      }
+      c.nextSeq = ((int32_t)(runEnd - lo) > 0) ? runEnd : lo;
+      c.endSeq  = hi;
+    }
+  }
+
+  return scanLowerBound(c, ts, inRun, runStart, pos) ? pos : (inRun ? runStart : hi);
+}
+
+/***************** openHistoryRange *********************************************
+ * params: c, fromTs, toTs
+ * return: size_t
+ * Description:
+ * Positions the cursor on all samples with fromTs <= ts <= toTs (inclusive)
+ * using two binary searches over the block index instead of a tail read.
+ * Returns the number of samples in range.
+ ******************************************************************************/
+size_t openHistoryRange(HistoryCursor& c, uint32_t fromTs, uint32_t toTs)
+{
+  const uint32_t endSeq = hdr.seq + stageCount;
+  const uint32_t oldest = histFile ? oldestSeq : endSeq;
+
+  c.nextSeq = endSeq;
+  c.endSeq  = endSeq;
+  if (oldest == endSeq || toTs < fromTs)
+  {
+    return 0;
+  }
+
+  c.nextSeq = lowerBoundTs(fromTs, oldest, endSeq);
+  c.endSeq  = (toTs == UINT32_MAX) ? endSeq : lowerBoundTs(toTs + 1, c.nextSeq, endSeq);
+  return c.endSeq - c.nextSeq;
+}
+
+/***************** getHistoryOldestTs *******************************************
+ * params: none
+ * return: uint32_t
+ * Description:
+ * Epoch timestamp of the oldest raw sample (UINT32_MAX if none). Looks at
+ * the keyTs of the first HIST_KEY_BLOCKS blocks, then at the staged samples.
+ ******************************************************************************/
+uint32_t getHistoryOldestTs()
+{
+  if (!histFile)
+  {
+    return UINT32_MAX;
+  }
+
+  BlockHeader bh;
+  for (uint32_t p = 0; p < hdr.blocks && p < HIST_KEY_BLOCKS; p++)
+  {
+    if (readBlockHeader(blockAt(p), bh) && bh.count > 0 && bh.keyTs != UINT32_MAX)
+    {
+      return bh.keyTs;
+    }
+  }
+  for (uint32_t i = 0; i < stageCount; i++)
+  {
+    if (stage[i].tsSec >= HIST_EPOCH_MIN)
+    {
+      return stage[i].tsSec;
+    }
+  }
+  return UINT32_MAX;
+}
+
 /***************** readHistoryTail *********************************************
  * params: maxOut, outBuf, outCount
  * return: size_t
  * Description:
- * Liest die letzten maxOut Datensätze (neueste zuerst im Buffer-Index aufsteigend).
+ * Liest die letzten maxOut Datensätze (ältester zuerst) über einen Cursor.
  ******************************************************************************/
 size_t readHistoryTail(size_t maxOut, LogSample* outBuf, size_t* outCount)
 {
@@ -162,18 +1514,27 @@ size_t readHistoryTail(size_t maxOut, LogSample* outBuf, size_t* outCount)
     return 0;
   }
 
-  const size_t n = (hdr.count < maxOut) ? hdr.count : maxOut;
-
-  for (size_t i = 0; i < n; i++)
+  HistoryCursor c;
+  const size_t n = openHistoryTail(c, maxOut);
+  size_t got = 0;
+  while (got < n)
   {
-    // Ältester Index innerhalb der letzten n Elemente:
-    const uint32_t idx = (hdr.head + hdr.capacity - n + i) % hdr.capacity;
-    histFile.seek(recOffset(idx), SeekSet);
-    histFile.read((uint8_t*)&outBuf[i], sizeof(LogSample));
+    const size_t r = readHistoryCursor(c, &outBuf[got], n - got);
+    if (r == 0)
+    {
+      break;
+    }
+    got += r;
   }
 
-  if (outCount) *outCount = n;
-  return n;
+  if (outCount) *outCount = got;
+  return got;
+}
+
+/***************** getHistoryStats **********************************************/
+const HistoryStats& getHistoryStats()
+{
+  return histStats;
 }
 
 /***************** handleHistory ************************************************
@@ -193,6 +1554,13 @@ void handleHistory()
     return; // Logging deaktiviert
   }
 
+  // Alters-Trigger für den Staging-Puffer
+  if (stageCount > 0 &&
+      nowMs - stageSinceMs >= (unsigned long)HISTORY_STAGE_MAX_AGE_MIN * 60000UL)
+  {
+    flushHistory();
+  }
+
   if (nextDue == 0)
   {
     // Erste Planung (ab jetzt in festen Takten)
@@ -215,7 +1583,7 @@ void handleHistory()
     s.setPointCenti   = (int16_t)roundf(getSetPoint() * 100.0f);
     s.hysteresisCenti = (int16_t)roundf(getHysteresis() * 100.0f);
     s.flags           = (isHeaterOn() ? 0x01 : 0x00);
-    s.rsv             = 0;
+    s.seq             = 0;
 
     if (!appendHistory(s))
     {
@@ -224,6 +1592,7 @@ void handleHistory()
     else
     {
       Serial.println(F("[HIST] append succeded"));
+      addRollupSample(s);
     }
   }
 
@@ -13,21 +13,36 @@
 #define HISTORY_FILE_BYTES (256UL * 1024UL)  // 256 KB Ringpuffer
 #endif
 
+// Storage block: base sample + bit-packed deltas (~1.2 B/sample, v4: 12 B)
+#ifndef HISTORY_BLOCK_BYTES
+#define HISTORY_BLOCK_BYTES 256
+#endif
+
 #ifndef HISTORY_FILE_PATH
 #define HISTORY_FILE_PATH "/hist.bin"
 #endif
 
+// Write-behind: flush after this many samples or this age, whichever first
+#ifndef HISTORY_STAGE_RECORDS
+#define HISTORY_STAGE_RECORDS 6
+#endif
+
+#ifndef HISTORY_STAGE_MAX_AGE_MIN
+#define HISTORY_STAGE_MAX_AGE_MIN 30
+#endif
+
 /***************** LogSample ****************************************************
  * params: n/a
  * return: n/a
  * Description:
- * Compact, fixed-size record: 12 bytes total.
+ * Sample as delivered by the read API (12 bytes). On flash, samples are
+ * packed into blocks as deltas to their predecessor (see history.cpp).
  * - tsSec           : uint32_t epoch seconds (UTC)
  * - tempCenti       : int16_t  temperature * 100 (°C * 100)
  * - setPointCenti   : int16_t  set point  * 100 (°C * 100)
  * - hysteresisCenti : int16_t  hysteresis * 100 (°C * 100)
  * - flags           : bit0 = heaterOn (1=ON), bit1..7 reserved
- * - rsv             : reserved for alignment/future use
+ * - seq             : low 8 bits of the write sequence (set by appendHistory)
  ******************************************************************************/
 struct LogSample
 {
@@ -36,14 +51,52 @@ struct LogSample
   int16_t  setPointCenti;
   int16_t  hysteresisCenti;
   uint8_t  flags;
-  uint8_t  rsv;
+  uint8_t  seq;
+};
+
+/***************** HistoryCursor ************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Read position for chunked history access. Positions are absolute write
+ * sequence numbers, so a cursor stays valid while new samples are appended
+ * between reads. Callers provide their own small buffer per read.
+ ******************************************************************************/
+struct HistoryCursor
+{
+  uint32_t nextSeq;   // next sample to deliver
+  uint32_t endSeq;    // one past the last sample to deliver
+};
+
+/***************** HistoryStats *************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Cost counters for the write path. appendHistory() latencies cover staging
+ * (plus the flush when one is triggered); flush latencies cover the flash I/O.
+ ******************************************************************************/
+struct HistoryStats
+{
+  uint32_t appends;
+  uint32_t lastAppendUs;
+  uint32_t maxAppendUs;
+  uint32_t totalAppendUs;
+  uint32_t flushes;
+  uint32_t flushedRecords;
+  uint32_t flushErrors;
+  uint32_t lastFlushUs;
+  uint32_t maxFlushUs;
+  uint32_t totalFlushUs;
 };
 
 /***************** initHistory **************************************************
  * params: none
  * return: bool
  * Description:
- * Mounts LittleFS and (re)creates/validates a fixed-size ring buffer file.
+ * Mounts LittleFS and resumes the existing ring buffer file. The write
+ * position is recovered from the block headers if the file header is stale;
+ * a version 4 file (flat 12-byte records) is converted once. The file is
+ * only re-created on corruption or when HISTORY_FILE_BYTES/BLOCK_BYTES change.
  ******************************************************************************/
 bool initHistory();
 
@@ -51,26 +104,102 @@ bool initHistory();
  * params: none
  * return: void
  * Description:
- * Periodic sampler. Every HISTORY_SAMPLE_PERIOD_MIN minutes appends one record
- * using getUnixTimeSec() (0 -> skip until NTP is ready).
+ * Periodic sampler. Every LOG_INTERVAL_MINUTES appends one record using
+ * getEpochOrUptimeSec() and feeds it into the hourly/daily rollups.
  ******************************************************************************/
 void handleHistory();
 
+/***************** appendHistory ************************************************
+ * params: sample
+ * return: bool
+ * Description:
+ * Stages one LogSample in RAM. Staged samples are written to flash in one
+ * batch after HISTORY_STAGE_RECORDS samples or HISTORY_STAGE_MAX_AGE_MIN.
+ * Returns true once the sample is staged (false only without a history
+ * file). A failed write is counted in HistoryStats::flushErrors and the
+ * samples stay staged for the next attempt.
+ ******************************************************************************/
+bool appendHistory(const LogSample& sample);
+
 /***************** appendHistory ************************************************
  * params: tsSec, tempCenti, heaterOn
  * return: bool
  * Description:
- * Appends a single LogSample into the ring buffer immediately using the
- * current set point and hysteresis values for threshold reconstruction.
+ * Builds a LogSample using the current set point and hysteresis values for
+ * threshold reconstruction and stages it like appendHistory(sample).
  ******************************************************************************/
 bool appendHistory(uint32_t tsSec, int16_t tempCenti, bool heaterOn);
 
+/***************** flushHistory *************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Writes all staged samples to flash now. Call before OTA or a reboot.
+ ******************************************************************************/
+bool flushHistory();
+
+/***************** getHistoryStats **********************************************
+ * params: none
+ * return: const HistoryStats&
+ * Description:
+ * Returns append/flush counters and latencies.
+ ******************************************************************************/
+const HistoryStats& getHistoryStats();
+
 /***************** readHistoryTail *********************************************
  * params: maxOut, outBuf, outCount
  * return: size_t
  * Description:
- * Reads up to maxOut most-recent samples into outBuf. Returns number read.
+ * Reads up to maxOut most-recent samples (flushed and staged) into outBuf.
+ * Returns number read.
  ******************************************************************************/
 size_t readHistoryTail(size_t maxOut, LogSample* outBuf, size_t* outCount);
 
+/***************** openHistoryTail **********************************************
+ * params: c, maxRecords
+ * return: size_t
+ * Description:
+ * Opens a cursor over the last maxRecords samples. Returns how many it covers.
+ ******************************************************************************/
+size_t openHistoryTail(HistoryCursor& c, size_t maxRecords);
+
+/***************** openHistoryFrom **********************************************
+ * params: c, seq
+ * return: size_t
+ * Description:
+ * Opens a cursor from absolute sample number seq to the newest sample, for
+ * incremental sync. A seq past the newest sample (history was reset) yields
+ * an empty cursor whose endSeq is below seq. Returns how many it covers.
+ ******************************************************************************/
+size_t openHistoryFrom(HistoryCursor& c, uint32_t seq);
+
+/***************** readHistoryCursor ********************************************
+ * params: c, buf, maxCount
+ * return: size_t
+ * Description:
+ * Reads the next chunk (oldest first, at most maxCount) into buf.
+ * Returns 0 once the cursor is exhausted.
+ ******************************************************************************/
+size_t readHistoryCursor(HistoryCursor& c, LogSample* buf, size_t maxCount);
+
+/***************** openHistoryRange *********************************************
+ * params: c, fromTs, toTs
+ * return: size_t
+ * Description:
+ * Opens a cursor over all samples with fromTs <= tsSec <= toTs (epoch
+ * seconds, toTs = UINT32_MAX for "up to now"). Samples stamped with uptime
+ * before NTP sync are placed just before the next epoch-stamped sample.
+ * Returns how many samples the cursor covers.
+ ******************************************************************************/
+size_t openHistoryRange(HistoryCursor& c, uint32_t fromTs, uint32_t toTs);
+
+/***************** getHistoryOldestTs *******************************************
+ * params: none
+ * return: uint32_t
+ * Description:
+ * Epoch timestamp of the oldest raw sample still in the ring (UINT32_MAX if
+ * the ring is empty). Used to decide whether raw data covers a window.
+ ******************************************************************************/
+uint32_t getHistoryOldestTs();
+
 #endif
@@ -0,0 +1,723 @@
+#include "httpd.h"
+#include <lwip/tcp.h>
+
+enum HttpPhase : uint8_t
+{
+  PH_FREE,
+  PH_READ,    // Request sammeln
+  PH_BODY,    // Antwort ausgeben (Puffer, Überlauf, Producer)
+  PH_CLOSE    // alles übergeben, auf ACK warten
+};
+
+static const size_t CHUNK_HEAD = 6;   // "XXXX\r\n" vor den Nutzdaten
+
+static WiFiServer httpServer(HTTPD_PORT);
+static HttpConn   conns[HTTPD_MAX_CLIENTS];
+static HttpRoute  routes[HTTPD_MAX_ROUTES];
+static uint8_t    routeCount = 0;
+
+/***************** statusText ***************************************************/
+static const char* statusText(int code)
+{
+  switch (code)
+  {
+    case 200: return "OK";
+    case 303: return "See Other";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 413: return "Payload Too Large";
+    case 503: return "Service Unavailable";
+    default:  return "Internal Server Error";
+  }
+}
+
+/***************** resetConn ****************************************************/
+static void resetConn(HttpConn& c)
+{
+  c.phase    = PH_FREE;
+  c.rxLen    = 0;
+  c.headLen  = 0;
+  c.bodyLen  = 0;
+  c.path     = "";
+  c.query    = "";
+  c.txLen    = 0;
+  c.txHead   = 0;
+  c.txOff    = 0;
+  c.chunked  = false;
+  c.status   = 0;
+  c.producer = nullptr;
+  c.release  = nullptr;
+  c.ctx      = nullptr;
+  c.step     = 0;
+  c.sent     = 0;
+  c.extraHeaders = String();
+  c.spill        = String();
+  c.txEnd      = 0;
+  c.terminated = false;
+}
+
+/***************** finishConn ***************************************************
+ * params: c, reason
+ * return: void
+ * Description:
+ * Releases the producer context, logs the request and frees the slot.
+ ******************************************************************************/
+static void finishConn(HttpConn& c, const char* reason)
+{
+  if (c.release != nullptr && c.ctx != nullptr)
+  {
+    c.release(c.ctx);
+  }
+  if (c.status != 0)
+  {
+    Serial.printf("[HTTP] %s %s -> %d, %u bytes, %lums%s\n",
+                  c.method == HTTPD_POST ? "POST" : "GET", c.path, c.status,
+                  (unsigned)c.sent, (unsigned long)(millis() - c.startMs), reason);
+  }
+  c.client.stop(1);
+  resetConn(c);
+}
+
+/***************** sealTx *******************************************************
+ * params: c, frame, last
+ * return: void
+ * Description:
+ * Turns the collected bytes into the drain window. With frame, the payload
+ * after txHead becomes one HTTP chunk; a response head still in front of it
+ * (txHead > 0, see httpStream()) goes out in the same write. With last, the
+ * closing chunk is appended as well, so short responses need a single write.
+ ******************************************************************************/
+static void sealTx(HttpConn& c, bool frame, bool last)
+{
+  if (!frame)
+  {
+    if (c.txLen > 0)
+    {
+      c.txOff = CHUNK_HEAD;
+      c.txEnd = CHUNK_HEAD + c.txLen;
+    }
+    c.txLen = 0;
+    return;
+  }
+
+  // [CHUNK_HEAD] [head: txHead - CHUNK_HEAD] [Chunk-Kopf] [Nutzdaten] CRLF "0" CRLF CRLF
+  const size_t start = (c.txHead > 0) ? CHUNK_HEAD : 0;
+  const size_t n     = c.txLen - c.txHead;
+  size_t end         = c.txHead;
+  if (n > 0)
+  {
+    char head[CHUNK_HEAD + 1];
+    snprintf(head, sizeof(head), "%04X\r\n", (unsigned)n);
+    memcpy(c.tx + c.txHead, head, CHUNK_HEAD);
+    end = CHUNK_HEAD + c.txLen;
+    c.tx[end++] = '\r';
+    c.tx[end++] = '\n';
+  }
+  if (last)
+  {
+    memcpy(c.tx + end, "0\r\n\r\n", 5);
+    end += 5;
+    c.terminated = true;
+  }
+  if (end > start)
+  {
+    c.txOff = start;
+    c.txEnd = end;
+  }
+  c.txLen  = 0;
+  c.txHead = 0;
+}
+
+/***************** drainTx ******************************************************
+ * params: c
+ * return: bool
+ * Description:
+ * Hands as much of the drain window to TCP as fits into its send buffer
+ * right now. Returns true once the window is empty.
+ ******************************************************************************/
+static bool drainTx(HttpConn& c)
+{
+  if (c.txEnd == 0)
+  {
+    return true;
+  }
+
+  size_t room = (size_t)c.client.availableForWrite();
+  const size_t left = c.txEnd - c.txOff;
+  if (room > left)
+  {
+    room = left;
+  }
+  if (room > 0)
+  {
+    const size_t w = c.client.write((const uint8_t*)c.tx + c.txOff, room);
+    if (w > 0)
+    {
+      c.txOff   += w;
+      c.sent    += w;
+      c.lastIoMs = millis();
+    }
+  }
+
+  if (c.txOff < c.txEnd)
+  {
+    return false;
+  }
+  c.txOff = 0;
+  c.txEnd = 0;
+  return true;
+}
+
+/***************** refillTx *****************************************************
+ * params: c
+ * return: bool
+ * Description:
+ * Fills the (drained) buffer: spilled bytes first, then producer steps until
+ * it is full, the producer has nothing right now or is done. Only full
+ * buffers and the final one are sealed, so a response leaves in as few
+ * segments as possible regardless of how small the producer's writes are.
+ * Returns false when the response is complete.
+ ******************************************************************************/
+static bool refillTx(HttpConn& c)
+{
+  if (c.spill.length() > 0)
+  {
+    size_t n = c.spill.length();
+    if (n > HTTPD_TX_BYTES - c.txLen)
+    {
+      n = HTTPD_TX_BYTES - c.txLen;
+    }
+    memcpy(c.tx + CHUNK_HEAD + c.txLen, c.spill.c_str(), n);
+    c.txLen += n;
+    c.spill.remove(0, n);
+  }
+
+  while (c.producer != nullptr && c.spill.length() == 0 && c.txLen < HTTPD_TX_BYTES)
+  {
+    const size_t before = c.txLen;
+    if (!c.producer(c))
+    {
+      c.producer = nullptr;
+    }
+    else if (c.txLen == before)
+    {
+      break;   // gerade nichts zu senden (z.B. Event-Stream)
+    }
+  }
+
+  const bool done = (c.producer == nullptr && c.spill.length() == 0);
+  sealTx(c, c.chunked, done && c.chunked && !c.terminated);
+  return !done || c.txEnd != 0;
+}
+
+/***************** findArg ******************************************************
+ * params: s, len, name, out
+ * return: bool
+ * Description:
+ * Looks up name in an x-www-form-urlencoded list and URL-decodes its value
+ * into out (if not null).
+ ******************************************************************************/
+static bool findArg(const char* s, size_t len, const char* name, String* out)
+{
+  const size_t nameLen = strlen(name);
+  size_t i = 0;
+  while (i < len)
+  {
+    size_t end = i;
+    while (end < len && s[end] != '&')
+    {
+      end++;
+    }
+    const char* eq = (const char*)memchr(s + i, '=', end - i);
+    const size_t keyLen = eq ? (size_t)(eq - (s + i)) : end - i;
+    if (keyLen == nameLen && strncmp(s + i, name, nameLen) == 0)
+    {
+      if (out != nullptr)
+      {
+        *out = String();
+        for (size_t k = eq ? (size_t)(eq - s) + 1 : end; k < end; k++)
+        {
+          char ch = s[k];
+          if (ch == '+')
+          {
+            ch = ' ';
+          }
+          else if (ch == '%' && k + 2 < end && isxdigit((unsigned char)s[k + 1]) &&
+                   isxdigit((unsigned char)s[k + 2]))
+          {
+            const char hex[3] = { s[k + 1], s[k + 2], 0 };
+            ch = (char)strtol(hex, nullptr, 16);
+            k += 2;
+          }
+          *out += ch;
+        }
+      }
+      return true;
+    }
+    i = end + 1;
+  }
+  return false;
+}
+
+/***************** bodyIsForm ***************************************************/
+static bool bodyIsForm(const HttpConn& c)
+{
+  return c.method == HTTPD_POST && c.bodyLen > 0 &&
+         httpHeader(c, "Content-Type").startsWith("application/x-www-form-urlencoded");
+}
+
+bool httpHasArg(const HttpConn& c, const char* name)
+{
+  return findArg(c.query, strlen(c.query), name, nullptr) ||
+         (bodyIsForm(c) && findArg(c.rx + c.headLen, c.bodyLen, name, nullptr));
+}
+
+String httpArg(const HttpConn& c, const char* name)
+{
+  String v;
+  if (!findArg(c.query, strlen(c.query), name, &v) && bodyIsForm(c))
+  {
+    findArg(c.rx + c.headLen, c.bodyLen, name, &v);
+  }
+  return v;
+}
+
+/***************** httpHeader ***************************************************/
+String httpHeader(const HttpConn& c, const char* name)
+{
+  const size_t nameLen = strlen(name);
+  const char* p   = (const char*)memchr(c.rx, '\n', c.headLen);
+  const char* end = c.rx + c.headLen;
+
+  while (p != nullptr && ++p < end)
+  {
+    const char* eol = (const char*)memchr(p, '\n', end - p);
+    if (eol == nullptr)
+    {
+      break;
+    }
+    if ((size_t)(eol - p) > nameLen && p[nameLen] == ':' && strncasecmp(p, name, nameLen) == 0)
+    {
+      const char* v = p + nameLen + 1;
+      while (v < eol && *v == ' ')
+      {
+        v++;
+      }
+      const char* ve = eol;
+      while (ve > v && (ve[-1] == '\r' || ve[-1] == ' '))
+      {
+        ve--;
+      }
+      String out;
+      out.concat(v, ve - v);
+      return out;
+    }
+    p = eol;
+  }
+  return String();
+}
+
+/***************** httpBody *****************************************************/
+const char* httpBody(const HttpConn& c, size_t& len)
+{
+  len = c.bodyLen;
+  return c.rx + c.headLen;
+}
+
+/***************** writeHead ****************************************************/
+static void writeHead(HttpConn& c, int code, const char* type, long contentLength)
+{
+  char line[96];
+  c.status = code;
+  snprintf(line, sizeof(line), "HTTP/1.1 %d %s\r\n", code, statusText(code));
+  httpPrint(c, line);
+  if (type != nullptr)
+  {
+    httpPrint(c, "Content-Type: ");
+    httpPrint(c, type);
+    httpPrint(c, "\r\n");
+  }
+  if (contentLength < 0)
+  {
+    httpPrint(c, "Transfer-Encoding: chunked\r\n");
+  }
+  else
+  {
+    snprintf(line, sizeof(line), "Content-Length: %ld\r\n", contentLength);
+    httpPrint(c, line);
+  }
+  httpPrint(c, "Connection: close\r\n");
+  httpPrint(c, c.extraHeaders);
+  httpPrint(c, "\r\n");
+  c.extraHeaders = String();
+  c.phase = PH_BODY;
+}
+
+void httpAddHeader(HttpConn& c, const char* name, const String& value)
+{
+  c.extraHeaders += name;
+  c.extraHeaders += ": ";
+  c.extraHeaders += value;
+  c.extraHeaders += "\r\n";
+}
+
+void httpSend(HttpConn& c, int code, const char* type, const char* body)
+{
+  const size_t n = (body != nullptr) ? strlen(body) : 0;
+  writeHead(c, code, type, (long)n);
+  httpWrite(c, body, n);
+  sealTx(c, false, false);
+}
+
+/***************** produceProgmem ***********************************************
+ * Description:
+ * Producer behind httpSendP(): ctx = next byte, step = bytes left.
+ ******************************************************************************/
+static bool produceProgmem(HttpConn& c)
+{
+  size_t n = httpTxFree(c);
+  if (n > c.step)
+  {
+    n = c.step;
+  }
+  memcpy_P(c.tx + CHUNK_HEAD + c.txLen, (PGM_P)c.ctx, n);
+  c.txLen += n;
+  c.ctx    = (void*)((PGM_P)c.ctx + n);
+  c.step  -= n;
+  return c.step > 0;
+}
+
+void httpSendP(HttpConn& c, int code, const char* type, PGM_P data, size_t len)
+{
+  writeHead(c, code, type, (long)len);
+  c.producer = produceProgmem;   // Kopf und erste Daten in einem Puffer
+  c.release  = nullptr;
+  c.ctx      = (void*)data;
+  c.step     = len;
+}
+
+void httpStream(HttpConn& c, int code, const char* type, HttpProducer produce,
+                void* ctx, HttpRelease release)
+{
+  writeHead(c, code, type, -1);
+  if (c.spill.length() == 0 && c.txLen + CHUNK_HEAD < HTTPD_TX_BYTES)
+  {
+    // Kopf bleibt im Puffer, der erste Chunk folgt direkt dahinter
+    c.txLen += CHUNK_HEAD;
+    c.txHead = c.txLen;
+  }
+  else
+  {
+    sealTx(c, false, false);
+  }
+  c.chunked  = true;
+  c.producer = produce;
+  c.release  = release;
+  c.ctx      = ctx;
+  c.step     = 0;
+}
+
+/***************** Producer output **********************************************/
+size_t httpTxFree(const HttpConn& c)
+{
+  if (c.txEnd != 0 || c.spill.length() > 0)
+  {
+    return 0;
+  }
+  return HTTPD_TX_BYTES - c.txLen;
+}
+
+void httpWrite(HttpConn& c, const char* data, size_t n)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  const size_t room = (c.txEnd == 0 && c.spill.length() == 0) ? HTTPD_TX_BYTES - c.txLen : 0;
+  const size_t part = (n < room) ? n : room;
+  memcpy(c.tx + CHUNK_HEAD + c.txLen, data, part);
+  c.txLen += part;
+  if (part < n)
+  {
+    c.spill.concat(data + part, n - part);
+  }
+}
+
+void httpPrint(HttpConn& c, const char* s)
+{
+  httpWrite(c, s, strlen(s));
+}
+
+void httpPrint(HttpConn& c, const String& s)
+{
+  httpWrite(c, s.c_str(), s.length());
+}
+
+void httpPrint_P(HttpConn& c, PGM_P s)
+{
+  size_t n = strlen_P(s);
+  size_t direct = httpTxFree(c);
+  if (direct > n)
+  {
+    direct = n;
+  }
+  memcpy_P(c.tx + CHUNK_HEAD + c.txLen, s, direct);   // direkt aus dem Flash
+  c.txLen += direct;
+  s += direct;
+  n -= direct;
+
+  char buf[64];
+  while (n > 0)
+  {
+    const size_t part = (n < sizeof(buf)) ? n : sizeof(buf);
+    memcpy_P(buf, s, part);
+    httpWrite(c, buf, part);
+    s += part;
+    n -= part;
+  }
+}
+
+void httpPrintInt(HttpConn& c, long v)
+{
+  char buf[12];
+  httpWrite(c, buf, (size_t)snprintf(buf, sizeof(buf), "%ld", v));
+}
+
+void httpPrintFixed(HttpConn& c, float v, uint8_t decimals)
+{
+  char buf[24];
+  const int n = snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+  httpWrite(c, buf, (n > 0 && (size_t)n < sizeof(buf)) ? (size_t)n : 0);
+}
+
+/***************** httpOn *******************************************************/
+void httpOn(const char* path, HttpMethod method, HttpHandler handler)
+{
+  if (routeCount >= HTTPD_MAX_ROUTES)
+  {
+    Serial.printf("[HTTP] Route table full, %s dropped\n", path);
+    return;
+  }
+  routes[routeCount++] = { path, method, handler };
+}
+
+/***************** dispatch *****************************************************
+ * params: c
+ * return: void
+ * Description:
+ * Splits the request line in place and runs the matching handler.
+ ******************************************************************************/
+static void dispatch(HttpConn& c)
+{
+  c.rx[c.headLen + c.bodyLen] = '\0';
+
+  char* sp1 = strchr(c.rx, ' ');
+  char* sp2 = sp1 ? strchr(sp1 + 1, ' ') : nullptr;
+  if (sp1 == nullptr || sp2 == nullptr || sp2 > c.rx + c.headLen)
+  {
+    httpSend(c, 400, "text/plain", "Bad Request");
+    return;
+  }
+  *sp2 = '\0';
+  c.path  = sp1 + 1;
+  char* q = strchr(sp1 + 1, '?');
+  if (q != nullptr)
+  {
+    *q = '\0';
+    c.query = q + 1;
+  }
+
+  if (strncmp(c.rx, "GET ", 4) == 0)
+  {
+    c.method = HTTPD_GET;
+  }
+  else if (strncmp(c.rx, "POST ", 5) == 0)
+  {
+    c.method = HTTPD_POST;
+  }
+  else
+  {
+    c.method = HTTPD_ANY;
+    httpSend(c, 405, "text/plain", "Method Not Allowed");
+    return;
+  }
+
+  bool pathKnown = false;
+  for (uint8_t i = 0; i < routeCount; i++)
+  {
+    if (strcmp(routes[i].path, c.path) != 0)
+    {
+      continue;
+    }
+    pathKnown = true;
+    if (routes[i].method == HTTPD_ANY || routes[i].method == c.method)
+    {
+      routes[i].handler(c);
+      if (c.phase == PH_READ)
+      {
+        httpSend(c, 500, "text/plain", "No response");
+      }
+      return;
+    }
+  }
+  httpSend(c, pathKnown ? 405 : 404, "text/plain", pathKnown ? "Method Not Allowed" : "Not Found");
+}
+
+/***************** readRequest **************************************************
+ * params: c
+ * return: void
+ * Description:
+ * Collects request bytes without waiting; dispatches once head and body
+ * (Content-Length) are complete.
+ ******************************************************************************/
+static void readRequest(HttpConn& c)
+{
+  int avail = c.client.available();
+  if (avail > 0)
+  {
+    size_t room = HTTPD_RX_BYTES - c.rxLen;
+    if ((size_t)avail < room)
+    {
+      room = (size_t)avail;
+    }
+    const int r = c.client.read((uint8_t*)c.rx + c.rxLen, room);
+    if (r > 0)
+    {
+      c.rxLen   += (size_t)r;
+      c.lastIoMs = millis();
+    }
+  }
+
+  if (c.headLen == 0)
+  {
+    for (size_t i = 3; i < c.rxLen; i++)
+    {
+      if (c.rx[i] == '\n' && c.rx[i - 1] == '\r' && c.rx[i - 2] == '\n' && c.rx[i - 3] == '\r')
+      {
+        c.headLen = i + 1;
+        break;
+      }
+    }
+    if (c.headLen == 0)
+    {
+      if (c.rxLen == HTTPD_RX_BYTES)
+      {
+        c.path = "?";
+        httpSend(c, 413, "text/plain", "Request too large");
+      }
+      return;
+    }
+    c.bodyLen = (size_t)httpHeader(c, "Content-Length").toInt();
+    if (c.headLen + c.bodyLen > HTTPD_RX_BYTES)
+    {
+      c.path = "?";
+      httpSend(c, 413, "text/plain", "Request too large");
+      return;
+    }
+  }
+
+  if (c.rxLen >= c.headLen + c.bodyLen)
+  {
+    dispatch(c);
+  }
+}
+
+/***************** serviceConn **************************************************/
+static void serviceConn(HttpConn& c)
+{
+  const unsigned long now = millis();
+
+  if (c.phase == PH_READ)
+  {
+    readRequest(c);
+  }
+
+  if (c.phase == PH_BODY)
+  {
+    // höchstens ein Puffer (ein Segment) pro Durchlauf
+    if (drainTx(c))
+    {
+      if (!refillTx(c))
+      {
+        c.phase = PH_CLOSE;
+      }
+      else
+      {
+        drainTx(c);
+      }
+    }
+  }
+
+  if (c.phase == PH_CLOSE)
+  {
+#ifdef TCP_SND_BUF
+    const bool acked = c.client.availableForWrite() >= TCP_SND_BUF;
+#else
+    const bool acked = true;
+#endif
+    if (acked || !c.client.connected() || now - c.lastIoMs > HTTPD_TIMEOUT_MS)
+    {
+      finishConn(c, "");
+    }
+    return;
+  }
+
+  if (!c.client.connected() && c.client.available() == 0)
+  {
+    finishConn(c, " (client gone)");
+  }
+  else if (now - c.lastIoMs > HTTPD_TIMEOUT_MS)
+  {
+    finishConn(c, " (timeout)");
+  }
+}
+
+/***************** initHttpd ****************************************************/
+void initHttpd()
+{
+  for (size_t i = 0; i < HTTPD_MAX_CLIENTS; i++)
+  {
+    resetConn(conns[i]);
+  }
+  httpServer.begin();
+  httpServer.setNoDelay(true);
+  Serial.printf("[HTTP] Listening on port %d, %d connections\n", HTTPD_PORT, HTTPD_MAX_CLIENTS);
+}
+
+/***************** handleHttpd **************************************************/
+void handleHttpd()
+{
+  // nur annehmen, wenn ein Slot frei ist; sonst wartet die Verbindung in
+  // der Warteschlange des Servers, bis ein Slot frei wird
+  HttpConn* slot = nullptr;
+  for (size_t i = 0; i < HTTPD_MAX_CLIENTS; i++)
+  {
+    if (conns[i].phase == PH_FREE)
+    {
+      slot = &conns[i];
+      break;
+    }
+  }
+  if (slot != nullptr)
+  {
+    WiFiClient nc = httpServer.accept();
+    if (nc)
+    {
+      slot->client = nc;
+      slot->client.setNoDelay(true);
+      slot->phase    = PH_READ;
+      slot->startMs  = millis();
+      slot->lastIoMs = slot->startMs;
+    }
+  }
+
+  for (size_t i = 0; i < HTTPD_MAX_CLIENTS; i++)
+  {
+    if (conns[i].phase != PH_FREE)
+    {
+      serviceConn(conns[i]);
+    }
+  }
+}
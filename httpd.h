@@ -0,0 +1,177 @@
+#ifndef HTTPD_H
+#define HTTPD_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+/***************** Configuration ************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * Connection slots and per-connection buffers (~2.2 KB per slot, static).
+ * HTTPD_RX_BYTES bounds request line + headers + form body. HTTPD_TX_BYTES
+ * is the payload of one chunk; with the 8 bytes of chunk framing it fits
+ * one 1460-byte TCP segment, and a chunk is only sent when full or last.
+ * A connection without progress for HTTPD_TIMEOUT_MS is dropped.
+ ******************************************************************************/
+#ifndef HTTPD_PORT
+#define HTTPD_PORT 80
+#endif
+
+#ifndef HTTPD_MAX_CLIENTS
+#define HTTPD_MAX_CLIENTS 4
+#endif
+
+#ifndef HTTPD_RX_BYTES
+#define HTTPD_RX_BYTES 768
+#endif
+
+#ifndef HTTPD_TX_BYTES
+#define HTTPD_TX_BYTES 1400
+#endif
+
+// Routes registered with httpOn(); web.cpp checks its table against this
+#ifndef HTTPD_MAX_ROUTES
+#define HTTPD_MAX_ROUTES 24
+#endif
+
+#ifndef HTTPD_TIMEOUT_MS
+#define HTTPD_TIMEOUT_MS 10000UL
+#endif
+
+enum HttpMethod : uint8_t
+{
+  HTTPD_ANY,
+  HTTPD_GET,
+  HTTPD_POST
+};
+
+struct HttpConn;
+
+// Request handler: runs once per request and must answer with httpSend(),
+// httpSendP() or httpStream() (no answer -> 500).
+typedef void (*HttpHandler)(HttpConn& c);
+
+// Route table entry, see httpOn()
+struct HttpRoute
+{
+  const char* path;
+  HttpMethod  method;
+  HttpHandler handler;
+};
+
+// Response producer: called whenever the previous output has been handed to
+// TCP, repeatedly until the buffer is full. Appends the next piece with
+// httpWrite() (ideally at most httpTxFree() bytes) and returns false when
+// done. Writing nothing ends the pass (nothing to send right now).
+typedef bool (*HttpProducer)(HttpConn& c);
+
+// Releases the producer context (also on aborted connections).
+typedef void (*HttpRelease)(void* ctx);
+
+/***************** HttpConn *****************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * One connection slot. Handlers and producers only use the accessors below
+ * plus ctx/step, which are theirs for the lifetime of the response.
+ ******************************************************************************/
+struct HttpConn
+{
+  WiFiClient    client;
+  uint8_t       phase;
+  HttpMethod    method;
+  char          rx[HTTPD_RX_BYTES + 1];
+  size_t        rxLen;
+  size_t        headLen;      // Requestzeile + Header inkl. Leerzeile
+  size_t        bodyLen;      // laut Content-Length
+  const char*   path;
+  const char*   query;
+  char          tx[HTTPD_TX_BYTES + 13];   // + Chunk-Rahmen + Abschluss-Chunk
+  size_t        txLen;        // gesammelte Nutzdaten
+  size_t        txHead;       // davon ungerahmter Antwortkopf (nur erster Chunk)
+  size_t        txOff;        // Drain-Fenster [txOff, txEnd), 0/0 = frei
+  size_t        txEnd;
+  bool          chunked;
+  bool          terminated;   // Abschluss-Chunk geschrieben
+  String        extraHeaders;
+  String        spill;        // Überlauf eines Producer-Schritts
+  int           status;
+  HttpProducer  producer;
+  HttpRelease   release;
+  void*         ctx;
+  uint32_t      step;
+  size_t        sent;
+  unsigned long startMs;
+  unsigned long lastIoMs;
+};
+
+/***************** initHttpd ****************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Starts listening on HTTPD_PORT. Register routes with httpOn() first.
+ ******************************************************************************/
+void initHttpd();
+
+/***************** handleHttpd **************************************************
+ * params: none
+ * return: void
+ * Description:
+ * One non-blocking pass over all connections: accepts a new client, reads
+ * pending request bytes, dispatches complete requests, produces at most one
+ * buffer per connection and hands as much output to TCP as it will take
+ * without waiting. Call from loop().
+ ******************************************************************************/
+void handleHttpd();
+
+/***************** httpOn *******************************************************
+ * params: path, method, handler
+ * return: void
+ * Description:
+ * Registers a handler for an exact path (query string ignored).
+ ******************************************************************************/
+void httpOn(const char* path, HttpMethod method, HttpHandler handler);
+
+/***************** Request accessors ********************************************
+ * Description:
+ * Arguments come from the query string and, for form POSTs, from the body
+ * (URL-decoded). Header names are case-insensitive. httpBody() gives the
+ * raw body of any other content type (e.g. JSON).
+ ******************************************************************************/
+bool   httpHasArg(const HttpConn& c, const char* name);
+String httpArg(const HttpConn& c, const char* name);
+String httpHeader(const HttpConn& c, const char* name);
+const char* httpBody(const HttpConn& c, size_t& len);   // roh, NUL-terminiert
+
+/***************** Responses ****************************************************
+ * Description:
+ * httpAddHeader() must precede the response call.
+ * httpSend()    : complete small response with Content-Length.
+ * httpSendP()   : PROGMEM body, copied out one buffer at a time.
+ * httpStream()  : chunked response produced by `produce`; `release(ctx)`
+ *                 runs once it is finished or the client went away.
+ ******************************************************************************/
+void httpAddHeader(HttpConn& c, const char* name, const String& value);
+void httpSend(HttpConn& c, int code, const char* type, const char* body);
+void httpSendP(HttpConn& c, int code, const char* type, PGM_P data, size_t len);
+void httpStream(HttpConn& c, int code, const char* type, HttpProducer produce,
+                void* ctx, HttpRelease release);
+
+/***************** Producer output **********************************************
+ * Description:
+ * Appends to the current chunk. Output beyond httpTxFree() is kept on the
+ * heap and sent before the producer is called again, so a step may
+ * overshoot a little but should not produce much more than that.
+ * httpPrint_P() copies straight from flash into the buffer; the number
+ * printers format on the stack instead of building String temporaries.
+ ******************************************************************************/
+void   httpWrite(HttpConn& c, const char* data, size_t n);
+void   httpPrint(HttpConn& c, const char* s);
+void   httpPrint(HttpConn& c, const String& s);
+void   httpPrint_P(HttpConn& c, PGM_P s);
+void   httpPrintInt(HttpConn& c, long v);
+void   httpPrintFixed(HttpConn& c, float v, uint8_t decimals);
+size_t httpTxFree(const HttpConn& c);
+
+#endif // HTTPD_H
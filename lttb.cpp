@@ -0,0 +1,231 @@
+#include "lttb.h"
+
+static inline uint8_t heaterOf(const RollupSample& r)
+{
+  return r.dutyPct >= 50 ? 1 : 0;
+}
+
+// Zeitachse relativ zum ersten Record (Epoch-Sekunden sprengen float)
+static inline float relTs(const LttbStream& st, const RollupSample& r)
+{
+  return (float)(int32_t)(r.tsSec - st.baseTs);
+}
+
+/***************** emitPoint ****************************************************/
+static void emitPoint(LttbStream& st, const RollupSample& r)
+{
+  st.emit(r, st.ctx);
+  st.anchor = r;
+  st.emitted++;
+}
+
+/***************** resetBucket **************************************************/
+static void resetBucket(LttbBucket& b, uint32_t id)
+{
+  b.id      = id;
+  b.n       = 0;
+  b.seen    = 0;
+  b.edges   = 0;
+  b.sumTs   = 0;
+  b.sumY    = 0;
+}
+
+/***************** selectFrom ***************************************************
+ * params: st, b, cTs, cY, nextEdges
+ * return: void
+ * Description:
+ * Emits all heater edges of bucket b if it has any, otherwise the candidate
+ * spanning the largest triangle with the previous point (A) and the
+ * average of the next bucket (C). Every edge beyond the first costs one
+ * point; an edge-free bucket pays it back by skipping its pick, also in
+ * advance for the edges of the next bucket (nextEdges).
+ ******************************************************************************/
+static void selectFrom(LttbStream& st, const LttbBucket& b, float cTs, float cY, uint8_t nextEdges)
+{
+  if (b.edges > 0)
+  {
+    for (uint8_t i = 0; i < b.edges; i++)
+    {
+      emitPoint(st, b.edge[i]);
+    }
+    st.debt += b.edges - 1;
+    return;
+  }
+  if (b.n == 0)
+  {
+    return;
+  }
+  if (st.debt + (nextEdges > 1 ? nextEdges - 1 : 0) > 0)
+  {
+    st.debt--;
+    return;
+  }
+
+  // Zeit relativ zu A, damit float reicht
+  const float aY  = st.anchor.tAvgCenti;
+  const float cX  = cTs - relTs(st, st.anchor);
+  uint16_t best = 0;
+  float bestArea = -1.0f;
+  for (uint16_t i = 0; i < b.n; i++)
+  {
+    const float pX = (float)(int32_t)(b.pts[i].tsSec - st.anchor.tsSec);
+    const float pY = b.pts[i].tAvgCenti;
+    float area = cX * (pY - aY) - pX * (cY - aY);
+    if (area < 0)
+    {
+      area = -area;
+    }
+    if (area > bestArea)
+    {
+      bestArea = area;
+      best = i;
+    }
+  }
+  emitPoint(st, b.pts[best]);
+}
+
+/***************** bucketAvg ****************************************************/
+static void bucketAvg(const LttbBucket& b, float& ts, float& y)
+{
+  ts = (float)((double)b.sumTs / b.seen);  // relativ zu baseTs
+  y  = (float)((double)b.sumY / b.seen);
+}
+
+/***************** lttbBegin ****************************************************/
+void lttbBegin(LttbStream& st, size_t total, size_t maxPoints, LttbEmit emit, void* ctx)
+{
+  st.emit        = emit;
+  st.ctx         = ctx;
+  st.total       = total;
+  st.index       = 0;
+  st.emitted     = 0;
+  st.haveHeld    = false;
+  st.haveCur     = false;
+  st.lastOn      = 0;
+  st.debt        = 0;
+  st.passThrough = (maxPoints == 0) || (total <= maxPoints) || (maxPoints < 3);
+  st.buckets     = st.passThrough ? 0 : maxPoints - 2;
+
+  // erwartete Bucketgröße -> Ausdünnung der Kandidaten
+  const size_t perBucket = st.passThrough ? 1 : (total - 2 + st.buckets - 1) / st.buckets;
+  st.stride = (uint32_t)((perBucket + LTTB_BUCKET_MAX - 1) / LTTB_BUCKET_MAX);
+  if (st.stride == 0)
+  {
+    st.stride = 1;
+  }
+  resetBucket(st.fill, 0);
+}
+
+/***************** processRecord ************************************************
+ * params: st, r, k
+ * return: void
+ * Description:
+ * Handles record k (not the last one) of a decimated stream.
+ ******************************************************************************/
+static void processRecord(LttbStream& st, const RollupSample& r, size_t k)
+{
+  const uint8_t on = heaterOf(r);
+  if (k == 0)
+  {
+    st.baseTs = r.tsSec;
+    st.lastOn = on;
+    emitPoint(st, r);
+    return;
+  }
+
+  // Bucket von Record k (1..total-2), gleichmäßig auf st.buckets verteilt
+  size_t span = st.total > 2 ? st.total - 2 : 1;
+  uint32_t id = (uint32_t)(((uint64_t)(k - 1) * st.buckets) / span);
+  if (id >= st.buckets)
+  {
+    id = st.buckets - 1;
+  }
+
+  if (id != st.fill.id)
+  {
+    // fill ist komplett: cur mit C = Mittel(fill) auswählen, dann weiterreichen
+    if (st.haveCur)
+    {
+      float cTs, cY;
+      bucketAvg(st.fill, cTs, cY);
+      selectFrom(st, st.cur, cTs, cY, st.fill.edges);
+    }
+    st.cur = st.fill;
+    st.haveCur = (st.cur.seen > 0);
+    resetBucket(st.fill, id);
+  }
+
+  LttbBucket& b = st.fill;
+  if (on != st.lastOn)
+  {
+    // voll: letzten Platz überschreiben, erste und letzte Flanke bleiben
+    b.edge[b.edges < LTTB_EDGE_MAX ? b.edges++ : LTTB_EDGE_MAX - 1] = r;
+  }
+  st.lastOn = on;
+
+  if ((b.seen % st.stride) == 0 && b.n < LTTB_BUCKET_MAX)
+  {
+    b.pts[b.n++] = r;
+  }
+  b.seen++;
+  b.sumTs += (int32_t)(r.tsSec - st.baseTs);
+  b.sumY  += r.tAvgCenti;
+}
+
+/***************** lttbPush *****************************************************/
+void lttbPush(LttbStream& st, const RollupSample& r)
+{
+  if (st.passThrough)
+  {
+    emitPoint(st, r);
+    return;
+  }
+
+  if (st.haveHeld)
+  {
+    processRecord(st, st.held, st.index - 1);
+  }
+  st.held = r;
+  st.haveHeld = true;
+  st.index++;
+}
+
+/***************** lttbEnd ******************************************************/
+size_t lttbEnd(LttbStream& st)
+{
+  if (st.passThrough || !st.haveHeld)
+  {
+    return st.emitted;
+  }
+
+  const RollupSample& last = st.held;
+  if (st.index == 1)
+  {
+    emitPoint(st, last);
+    return st.emitted;
+  }
+
+  // cur gegen Mittel(fill), fill gegen den letzten Record
+  if (st.haveCur)
+  {
+    float cTs, cY;
+    if (st.fill.seen > 0)
+    {
+      bucketAvg(st.fill, cTs, cY);
+    }
+    else
+    {
+      cTs = relTs(st, last);
+      cY  = last.tAvgCenti;
+    }
+    selectFrom(st, st.cur, cTs, cY, st.fill.edges);
+  }
+  if (st.fill.seen > 0)
+  {
+    selectFrom(st, st.fill, relTs(st, last), (float)last.tAvgCenti, 0);
+  }
+
+  // Flanke genau auf dem letzten Record bleibt ebenfalls erhalten
+  emitPoint(st, last);
+  return st.emitted;
+}
@@ -0,0 +1,103 @@
+#ifndef LTTB_H
+#define LTTB_H
+
+#include <Arduino.h>
+#include "rollup.h"
+
+/***************** Configuration ************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * Candidates kept per bucket. Larger buckets are thinned evenly before the
+ * triangle test (bucket averages and heater edges still see every record).
+ * LTTB_EDGE_MAX heater edges are kept per bucket; beyond that the last slot
+ * is overwritten, so the first and the last edge always survive.
+ ******************************************************************************/
+#ifndef LTTB_BUCKET_MAX
+#define LTTB_BUCKET_MAX 32
+#endif
+
+#ifndef LTTB_EDGE_MAX
+#define LTTB_EDGE_MAX 8
+#endif
+
+// Upper bound for the maxPoints request parameter
+#ifndef HISTORY_MAX_POINTS_LIMIT
+#define HISTORY_MAX_POINTS_LIMIT 2000
+#endif
+
+typedef void (*LttbEmit)(const RollupSample& r, void* ctx);
+
+/***************** LttbBucket ***************************************************/
+struct LttbBucket
+{
+  uint32_t     id;
+  uint16_t     n;          // gespeicherte Kandidaten
+  uint32_t     seen;       // Records im Bucket
+  uint8_t      edges;
+  RollupSample edge[LTTB_EDGE_MAX];  // Records mit geändertem Heizzustand
+  int64_t      sumTs;      // relativ zu baseTs
+  int64_t      sumY;
+  RollupSample pts[LTTB_BUCKET_MAX];
+};
+
+/***************** LttbStream ***************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Streaming Largest-Triangle-Three-Buckets state (~1.4 KB). Holds the bucket
+ * waiting for its right neighbour plus the bucket being filled.
+ ******************************************************************************/
+struct LttbStream
+{
+  LttbEmit     emit;
+  void*        ctx;
+  size_t       total;      // angekündigte Records
+  size_t       buckets;    // maxPoints - 2
+  uint32_t     stride;     // Ausdünnung pro Bucket
+  size_t       index;      // bisher gepushte Records
+  size_t       emitted;
+  uint32_t     baseTs;     // tsSec des ersten Records
+  bool         passThrough;
+  bool         haveHeld;
+  RollupSample held;       // ein Record Vorlauf (der letzte wird immer gesendet)
+  RollupSample anchor;     // zuletzt gesendeter Punkt (A)
+  uint8_t      lastOn;     // Heizzustand des vorigen Records
+  int32_t      debt;       // Flanken über dem Budget, < 0: vorausbezahlt
+  bool         haveCur;
+  LttbBucket   cur;        // wartet auf den Mittelwert von fill
+  LttbBucket   fill;
+};
+
+/***************** lttbBegin ****************************************************
+ * params: st, total, maxPoints, emit, ctx
+ * return: void
+ * Description:
+ * Starts a stream of `total` records, of which at most maxPoints are
+ * emitted (maxPoints == 0 or total <= maxPoints: everything passes).
+ * Value axis is the mean temperature, time axis tsSec. Every record where
+ * the heater state (dutyPct >= 50) flips is emitted instead of the bucket's
+ * triangle pick, so on/off edges keep their exact time. A bucket with
+ * several edges uses the points of neighbouring edge-free buckets, which
+ * then skip their pick; only when edges alone need more than the budget
+ * (or edge buckets pile up at the end) does the output exceed maxPoints.
+ ******************************************************************************/
+void lttbBegin(LttbStream& st, size_t total, size_t maxPoints, LttbEmit emit, void* ctx);
+
+/***************** lttbPush *****************************************************
+ * params: st, r
+ * return: void
+ * Description:
+ * Feeds the next record (oldest first).
+ ******************************************************************************/
+void lttbPush(LttbStream& st, const RollupSample& r);
+
+/***************** lttbEnd ******************************************************
+ * params: st
+ * return: size_t
+ * Description:
+ * Flushes the pending buckets and the last record. Returns points emitted.
+ ******************************************************************************/
+size_t lttbEnd(LttbStream& st);
+
+#endif
@@ -0,0 +1,192 @@
+#include "metrics.h"
+#include "httpd.h"
+#include "config.h"
+#include "control.h"
+#include "history.h"
+#include "mqtt.h"
+#include "mqttqueue.h"
+
+// Obere Bucket-Grenzen in µs (le), +Inf implizit
+static const uint32_t bucketUs[] = { 50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000 };
+static const char* const bucketLe[] = { "0.00005", "0.0001", "0.00025", "0.0005", "0.001", "0.0025",
+                                        "0.005", "0.01", "0.025", "0.05", "0.1", "0.25" };
+static const size_t BUCKETS = sizeof(bucketUs) / sizeof(bucketUs[0]);
+
+static const char* const taskName[LT_COUNT] =
+{
+  "handleSensor", "handleControl", "handleWebServer", "ensureMQTT", "handleHistory"
+};
+
+struct LoopHistogram
+{
+  uint32_t counts[BUCKETS + 1];   // nicht kumulativ, letzter = +Inf
+  uint32_t count;
+  uint64_t sumUs;
+  uint32_t maxUs;
+};
+
+static LoopHistogram loopHist[LT_COUNT];
+
+/***************** metricsTime **************************************************/
+void metricsTime(LoopTask task, void (*fn)())
+{
+  const uint32_t t0 = micros();
+  fn();
+  const uint32_t dt = micros() - t0;
+
+  LoopHistogram& h = loopHist[task];
+  size_t b = 0;
+  while (b < BUCKETS && dt > bucketUs[b])
+  {
+    b++;
+  }
+  h.counts[b]++;
+  h.count++;
+  h.sumUs += dt;
+  if (dt > h.maxUs)
+  {
+    h.maxUs = dt;
+  }
+}
+
+/***************** printLine ****************************************************
+ * params: c, fmt, ...
+ * return: void
+ * Description:
+ * printf into the response (one metric line, < 160 bytes).
+ ******************************************************************************/
+static void printLine(HttpConn& c, const char* fmt, ...)
+{
+  char line[160];
+  va_list ap;
+  va_start(ap, fmt);
+  const int n = vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+  if (n > 0)
+  {
+    httpWrite(c, line, ((size_t)n < sizeof(line)) ? (size_t)n : sizeof(line) - 1);
+  }
+}
+
+// µs als Sekunden mit 6 Nachkommastellen, ohne float/64-bit-printf
+static void printSeconds(HttpConn& c, const char* prefix, uint64_t us)
+{
+  printLine(c, "%s %lu.%06lu\n", prefix, (unsigned long)(us / 1000000ULL), (unsigned long)(us % 1000000ULL));
+}
+
+// Einzelwert mit TYPE-Zeile direkt davor
+static void printMetric(HttpConn& c, const char* name, const char* type, unsigned long v)
+{
+  printLine(c, "# TYPE %s %s\n%s %lu\n", name, type, name, v);
+}
+
+static void printMetricSeconds(HttpConn& c, const char* name, const char* type, uint64_t us)
+{
+  printLine(c, "# TYPE %s %s\n", name, type);
+  printSeconds(c, name, us);
+}
+
+static void printLoopHistogram(HttpConn& c, uint8_t task)
+{
+  const LoopHistogram& h = loopHist[task];
+  const char* name = taskName[task];
+  char key[80];
+
+  uint32_t cum = 0;
+  for (size_t b = 0; b < BUCKETS; b++)
+  {
+    cum += h.counts[b];
+    printLine(c, "heatctl_loop_seconds_bucket{handler=\"%s\",le=\"%s\"} %lu\n", name, bucketLe[b], (unsigned long)cum);
+  }
+  printLine(c, "heatctl_loop_seconds_bucket{handler=\"%s\",le=\"+Inf\"} %lu\n", name, (unsigned long)h.count);
+  snprintf(key, sizeof(key), "heatctl_loop_seconds_sum{handler=\"%s\"}", name);
+  printSeconds(c, key, h.sumUs);
+  printLine(c, "heatctl_loop_seconds_count{handler=\"%s\"} %lu\n", name, (unsigned long)h.count);
+}
+
+// eigene Familie, daher getrennt von den Histogrammen
+static void printLoopMax(HttpConn& c)
+{
+  char key[80];
+  httpPrint_P(c, PSTR("# TYPE heatctl_loop_max_seconds gauge\n"));
+  for (uint8_t t = 0; t < LT_COUNT; t++)
+  {
+    snprintf(key, sizeof(key), "heatctl_loop_max_seconds{handler=\"%s\"}", taskName[t]);
+    printSeconds(c, key, loopHist[t].maxUs);
+  }
+}
+
+static void printHeap(HttpConn& c)
+{
+  printMetric(c, "heatctl_heap_free_bytes", "gauge", ESP.getFreeHeap());
+  printMetric(c, "heatctl_heap_max_block_bytes", "gauge", ESP.getMaxFreeBlockSize());
+  printMetric(c, "heatctl_heap_fragmentation_percent", "gauge", ESP.getHeapFragmentation());
+  printMetric(c, "heatctl_uptime_seconds", "counter", millis() / 1000UL);
+}
+
+static void printHistory(HttpConn& c)
+{
+  const HistoryStats& s = getHistoryStats();
+  printMetric(c, "heatctl_history_appends_total", "counter", s.appends);
+  printMetricSeconds(c, "heatctl_history_append_seconds_total", "counter", s.totalAppendUs);
+  printMetricSeconds(c, "heatctl_history_append_max_seconds", "gauge", s.maxAppendUs);
+  printMetric(c, "heatctl_history_flushes_total", "counter", s.flushes);
+  printMetric(c, "heatctl_history_flushed_records_total", "counter", s.flushedRecords);
+  printMetric(c, "heatctl_history_flush_errors_total", "counter", s.flushErrors);
+  printMetricSeconds(c, "heatctl_history_flush_seconds_total", "counter", s.totalFlushUs);
+  printMetricSeconds(c, "heatctl_history_flush_max_seconds", "gauge", s.maxFlushUs);
+}
+
+static void printCounters(HttpConn& c)
+{
+  const MqttStats& m = getMqttStats();
+  // jede saveConfig() ist genau ein EEPROM.commit()
+  printMetric(c, "heatctl_eeprom_commits_total", "counter", getConfigVersion());
+  printMetric(c, "heatctl_mqtt_reconnects_total", "counter", m.reconnects);
+  printMetric(c, "heatctl_mqtt_connect_failures_total", "counter", m.connectFailures);
+  printMetric(c, "heatctl_mqtt_publishes_total", "counter", m.publishes);
+  printMetric(c, "heatctl_mqtt_publish_failures_total", "counter", m.publishFailures);
+  printMetric(c, "heatctl_mqtt_telemetry_published_total", "counter", m.telemetrySent);
+  printMetric(c, "heatctl_mqtt_state_published_total", "counter", m.stateSent);
+  printMetric(c, "heatctl_mqtt_heartbeats_total", "counter", m.heartbeats);
+  printMetric(c, "heatctl_mqtt_agg_published_total", "counter", m.aggSent);
+  printMetric(c, "heatctl_mqtt_commands_total", "counter", m.commands);
+  printMetric(c, "heatctl_mqtt_command_errors_total", "counter", m.commandErrors);
+  printMetric(c, "heatctl_mqtt_command_commits_total", "counter", m.commandCommits);
+  printMetric(c, "heatctl_relay_switches_total", "counter", getRelaySwitchCount());
+}
+
+static void printMqttQueue(HttpConn& c)
+{
+  const MqttQueueStats& q = getMqttQueueStats();
+  printMetric(c, "heatctl_mqtt_queue_depth", "gauge", mqttQueueCount());
+  printMetric(c, "heatctl_mqtt_queued_total", "counter", q.queued);
+  printMetric(c, "heatctl_mqtt_replayed_total", "counter", q.replayed);
+  printMetric(c, "heatctl_mqtt_queue_dropped_total", "counter", q.dropped);
+  printMetric(c, "heatctl_mqtt_queue_spills_total", "counter", q.spills);
+}
+
+/***************** produceMetrics ***********************************************/
+bool produceMetrics(HttpConn& c)
+{
+  const uint32_t step = c.step++;
+  if (step < LT_COUNT)
+  {
+    if (step == 0)
+    {
+      httpPrint_P(c, PSTR("# HELP heatctl_loop_seconds Time spent per loop() handler call.\n"
+                          "# TYPE heatctl_loop_seconds histogram\n"));
+    }
+    printLoopHistogram(c, (uint8_t)step);
+    return true;
+  }
+
+  switch (step - LT_COUNT)
+  {
+    case 0:  printLoopMax(c);  return true;
+    case 1:  printHeap(c);     return true;
+    case 2:  printHistory(c);  return true;
+    case 3:  printCounters(c); return true;
+    default: printMqttQueue(c); return false;
+  }
+}
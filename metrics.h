@@ -0,0 +1,43 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+struct HttpConn;
+
+/***************** LoopTask *****************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * loop() handlers with their own time histogram.
+ ******************************************************************************/
+enum LoopTask : uint8_t
+{
+  LT_SENSOR,
+  LT_CONTROL,
+  LT_WEB,
+  LT_MQTT,
+  LT_HISTORY,
+  LT_COUNT
+};
+
+/***************** metricsTime **************************************************
+ * params: task, fn
+ * return: void
+ * Description:
+ * Runs fn and records its duration in the histogram of task. Costs two
+ * micros() calls and a short bucket scan, so it stays on in production.
+ ******************************************************************************/
+void metricsTime(LoopTask task, void (*fn)());
+
+/***************** produceMetrics ***********************************************
+ * params: c
+ * return: bool
+ * Description:
+ * httpd producer for /metrics (Prometheus text format 0.0.4): loop
+ * histograms, heap, history, EEPROM, MQTT, relay and MQTT queue counters.
+ * One group of families per step; returns false when done.
+ ******************************************************************************/
+bool produceMetrics(HttpConn& c);
+
+#endif // METRICS_H
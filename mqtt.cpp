@@ -2,183 +2,768 @@
 #include <PubSubClient.h>
 #include <ArduinoJson.h>
 #include <ESP8266WiFi.h>
+#include <lwip/dns.h>
 #include "mqtt.h"
+#include "tcpclient.h"
 #include "config.h"
 #include "secrets.h"
 #include "control.h"
 #include "sensor.h"
+#include "ntp.h"
+#include "mqttqueue.h"
+#include "mqttagg.h"
 
-WiFiClient espClient;
-PubSubClient mqttClient(espClient);
+/***************** MqttLink *****************************************************
+ * Description:
+ * Client between PubSubClient and the TcpClient, passes everything through.
+ * PubSubClient::connect() sends CONNECT and then busy-waits for CONNACK; after
+ * expectConnack() the link answers that wait with a local "accepted" CONNACK,
+ * so connect() returns right after sending. The broker's real CONNACK stays
+ * in the socket and is checked by the connect state machine (MQ_CONNACK).
+ ******************************************************************************/
+class MqttLink : public Client
+{
+public:
+  explicit MqttLink(TcpClient& c) : client(c) {}
+
+  void expectConnack() { ackPos = 0; }
+
+  int connect(IPAddress ip, uint16_t port) override    { return client.connect(ip, port); }
+  int connect(const char* host, uint16_t port) override { return client.connect(host, port); }
+  size_t write(uint8_t b) override                     { return client.write(b); }
+  size_t write(const uint8_t* buf, size_t n) override  { return client.write(buf, n); }
+  int available() override { return (ackPos < sizeof(ack)) ? (int)(sizeof(ack) - ackPos) : client.available(); }
+  int read() override      { return (ackPos < sizeof(ack)) ? ack[ackPos++] : client.read(); }
+  int peek() override      { return (ackPos < sizeof(ack)) ? ack[ackPos] : client.peek(); }
+  int read(uint8_t* buf, size_t n) override
+  {
+    if (ackPos < sizeof(ack))
+    {
+      size_t k = 0;
+      while (k < n && ackPos < sizeof(ack))
+      {
+        buf[k++] = ack[ackPos++];
+      }
+      return (int)k;
+    }
+    return client.read(buf, n);
+  }
+  void flush() override      { client.flush(); }
+  void stop() override       { ackPos = sizeof(ack); client.stop(); }
+  uint8_t connected() override { return client.connected(); }
+  operator bool() override   { return (bool)client; }
+
+private:
+  static constexpr uint8_t ack[4] = { 0x20, 0x02, 0x00, 0x00 };  // CONNACK, accepted
+  TcpClient&  client;
+  size_t      ackPos = sizeof(ack);
+};
+constexpr uint8_t MqttLink::ack[4];
+
+/***************** MqttPhase ****************************************************
+ * Description:
+ * Steps of the connect state machine, see ensureMQTT().
+ ******************************************************************************/
+enum MqttPhase : uint8_t
+{
+  MQ_IDLE,      // getrennt, wartet auf nextReconnectDue
+  MQ_DNS,       // Namensauflösung läuft
+  MQ_TCP,       // tcp_connect() läuft
+  MQ_CONNACK,   // CONNECT gesendet
+  MQ_SUBACK,    // SUBSCRIBE gesendet
+  MQ_ONLINE
+};
+
+static TcpClient mqttSock;
+static MqttLink  mqttLink(mqttSock);
+PubSubClient mqttClient(mqttLink);
+
+static const uint16_t mqttPort = 1883;
+static MqttPhase      phase        = MQ_IDLE;
+static unsigned long  phaseStart   = 0;
+static unsigned long  attemptStart = 0;
+static int            connError    = MQTT_DISCONNECTED;  // PubSubClient-Codes
+static IPAddress      brokerIp;
+static volatile uint8_t dnsState   = 0;   // 0 läuft, 1 ok, 2 fehlgeschlagen
+static uint32_t       dnsAttempt   = 0;   // verwirft Antworten alter Versuche
+static bool           attemptDone  = false; // erster Versuch abgeschlossen (oder kein WLAN)
 
-unsigned long lastReconnectAttempt = 0;
 unsigned long lastTelemetryPublish = 0;
 unsigned long lastStatePublish = 0;
 static unsigned long nextReconnectDue = 0;
 static unsigned long reconnectDelayMs = 5000;  // start with 5s
 static const unsigned long reconnectDelayMaxMs = 120000; // cap at 2min
+static const unsigned long publishGapMs = 1000;  // bündelt Mode+State-Wechsel
+static unsigned long lastReplay = 0;
+static MqttStats mqttStats = {};
+
+// zuletzt publizierte Werte (Basis für Deadband/Änderungserkennung)
+struct TelemetrySent
+{
+  bool    valid;
+  float   temp;
+  float   hum;
+  bool    heater;
+  uint8_t mode;
+  uint8_t state;
+};
+
+struct StateSent
+{
+  bool     valid;
+  uint32_t configVersion;
+  int16_t  setPointDeci;
+  uint8_t  mode;
+  uint8_t  state;
+};
+
+static TelemetrySent telemetrySent = {};
+static StateSent     stateSent     = {};
+static bool          heartbeatDue  = false;   // zählt den nächsten Publish als Heartbeat
 
 /***************** mqttCallback *************************************************
  * Description:
- * Handles incoming MQTT messages.
- * Parses JSON payloads and updates controller state accordingly.
+ * Handles incoming MQTT commands on <BASE_TOPIC>/cmd.
+ * The JSON is parsed in place in the PubSubClient buffer (zero-copy, no
+ * String), every field is validated into one ConfigPatch first and the
+ * message is rejected as a whole if any field is invalid. Config fields are
+ * then committed with a single EEPROM write; mode is applied separately
+ * (not persisted). No direct state publish: the scheduler picks up the
+ * change (config version / mode) and publishes once, or not at all if the
+ * command changed nothing.
  ******************************************************************************/
 void mqttCallback(char* topic, byte* payload, unsigned int length)
 {
-  String message;
-  for (unsigned int i = 0; i < length; i++)
-  {
-    message += (char)payload[i];
-  }
+  mqttStats.commands++;
 
-  StaticJsonDocument<384> doc;
-  DeserializationError error = deserializeJson(doc, message);
+  StaticJsonDocument<256> doc;   // Strings zeigen in payload, nur Knoten im Dokument
+  DeserializationError error = deserializeJson(doc, (char*)payload, length);
   if (error)
   {
+    mqttStats.commandErrors++;
     Serial.print(F("[MQTT] JSON parse failed: "));
     Serial.println(error.f_str());
     return;
   }
 
-  if (doc["setPoint"].is<float>())     { setDaySetPoint(doc["setPoint"]); setNightSetPoint(doc["setPoint"]); }
-  if (doc["daySetPoint"].is<float>())  { setDaySetPoint(doc["daySetPoint"]); }
-  if (doc["nightSetPoint"].is<float>()){ setNightSetPoint(doc["nightSetPoint"]); }
-  if (doc["dayStart"].is<int>())       { setDayStartMinutes(doc["dayStart"]); }
-  if (doc["nightStart"].is<int>())     { setNightStartMinutes(doc["nightStart"]); }
-  if (doc["hysteresis"].is<float>())   { setHysteresis(doc["hysteresis"]); }
-  if (doc["boostMinutes"].is<int>())   { setBoostMinutes(doc["boostMinutes"]); }
-  if (doc["mode"].is<int>())           { setControlMode((ControlMode)doc["mode"]); }
+  ConfigPatch patch;
+  int mode = -1;
+  for (JsonPair kv : doc.as<JsonObject>())
+  {
+    const char* key = kv.key().c_str();
+    const JsonVariant v = kv.value();
+    bool ok;
+    if (strcmp(key, "mode") == 0)
+    {
+      mode = v.is<int>() ? v.as<int>() : -1;
+      ok   = (mode >= MODE_AUTO && mode <= MODE_BOOST);
+    }
+    else
+    {
+      ok = v.is<float>() && configPatchSet(patch, key, v.as<float>()) == CFG_PATCH_OK;
+    }
+    if (!ok)
+    {
+      mqttStats.commandErrors++;
+      Serial.printf("[MQTT] Command rejected, field '%s'\n", key);
+      return;
+    }
+  }
 
-  publishState();
+  const uint32_t before = getConfigVersion();
+  applyConfigPatch(patch);
+  if (mode >= 0 && (ControlMode)mode != getControlMode())
+  {
+    setControlMode((ControlMode)mode);
+  }
+  mqttStats.commandCommits += getConfigVersion() - before;
 }
 
-/***************** mqttReconnect ************************************************
+/***************** dnsFound *****************************************************
  * Description:
- * Attempts to connect to the MQTT broker.
+ * lwIP callback for dns_gethostbyname(). addr is null if the name could not
+ * be resolved.
  ******************************************************************************/
-bool mqttReconnect()
+static void dnsFound(const char* name, const ip_addr_t* addr, void* arg)
 {
-  Serial.print(F("[MQTT] Connecting to broker "));
-  Serial.print(MQTT_HOST);
-  Serial.println(F(":1883 ..."));
-
-  String clientId = "HeatCtrl-" + String(ESP.getChipId(), HEX);
-  if (mqttClient.connect(clientId.c_str(), MQTT_USER, MQTT_PASS))
+  (void)name;
+  if ((uint32_t)(uintptr_t)arg != dnsAttempt)
   {
-    Serial.println(F("[MQTT] Connected!"));
-
-    String topic = String(BASE_TOPIC) + "/cmd";
-    mqttClient.subscribe(topic.c_str());
-    Serial.print(F("[MQTT] Subscribed to "));
-    Serial.println(topic);
-    return true;
+    return;   // Versuch schon abgebrochen (Timeout)
+  }
+  if (addr)
+  {
+    brokerIp = IPAddress(addr);
+    dnsState = 1;
   }
   else
   {
-    Serial.print(F("[MQTT] Connect failed, state="));
-    Serial.println(mqttClient.state());
-    return false;
+    dnsState = 2;
   }
 }
 
-/***************** ensureMQTT ***************************************************
+/***************** enterPhase ***************************************************/
+static void enterPhase(MqttPhase p, unsigned long now)
+{
+  phase      = p;
+  phaseStart = now;
+}
+
+/***************** connectFailed ************************************************
+ * params: step, code
+ * return: void
  * Description:
- * Ensures MQTT connection is alive.
- * Exponential backoff reconnect; LED overlays indicate status.
+ * Aborts the connect attempt: closes the socket, remembers code (a
+ * PubSubClient state) and schedules the next attempt with backoff.
  ******************************************************************************/
-void ensureMQTT()
+static void connectFailed(const char* step, int code)
+{
+  const unsigned long now = millis();
+  mqttClient.disconnect();   // setzt auch den Zustand von PubSubClient zurück
+  connError = code;
+  mqttStats.connectFailures++;
+  attemptDone = true;
+  enterPhase(MQ_IDLE, now);
+
+  reconnectDelayMs = min(reconnectDelayMs * 2, reconnectDelayMaxMs);
+  nextReconnectDue = now + reconnectDelayMs;
+  Serial.printf("[MQTT] Connect failed at %s (%s), next attempt in %lu s\n",
+                step, mqttConnStateText(), reconnectDelayMs / 1000);
+}
+
+/***************** connectOnline ************************************************
+ * Description:
+ * SUBACK received: connection is usable.
+ ******************************************************************************/
+static void connectOnline(unsigned long now)
 {
-  if (!mqttClient.connected())
+  Serial.printf("[MQTT] Connected in %lu ms\n", now - attemptStart);
+  mqttStats.reconnects++;
+  connError        = MQTT_CONNECTED;
+  reconnectDelayMs = 5000;
+  nextReconnectDue = 0;
+  attemptDone      = true;
+  enterPhase(MQ_ONLINE, now);
+
+  // nach (Re-)Connect sofort vollständigen Stand senden; mit Rückstau
+  // erst nach dem Replay (siehe replayQueue())
+  if (mqttQueueCount() == 0)
   {
-    // indicate MQTT problem while disconnected (unless WiFi overlay masks it)
-    unsigned long now = millis();
-    if (now >= nextReconnectDue)
+    telemetrySent.valid = false;
+    stateSent.valid     = false;
+  }
+}
+
+/***************** packetBuffered ***********************************************
+ * params: none
+ * return: bool
+ * Description:
+ * True if the next MQTT packet is completely in the socket buffer: fixed
+ * header plus remaining length (varint, up to 4 bytes) are peeked, nothing
+ * is consumed.
+ ******************************************************************************/
+static bool packetBuffered()
+{
+  const int avail = mqttSock.available();
+  uint8_t h[5];
+  const size_t n = mqttSock.peekBytes(h, avail < 5 ? (size_t)avail : sizeof(h));
+  uint32_t len = 0;
+  for (size_t i = 1; i < n; i++)
+  {
+    len |= (uint32_t)(h[i] & 0x7F) << (7 * (i - 1));
+    if ((h[i] & 0x80) == 0)
+    {
+      return (uint32_t)avail >= i + 1 + len;
+    }
+  }
+  return false;
+}
+
+/***************** connectStep **************************************************
+ * params: now
+ * return: void
+ * Description:
+ * Advances the connect state machine by one step (see mqtt.h). Nothing in
+ * here waits for the network: every phase polls its result and gives up
+ * after its own timeout.
+ ******************************************************************************/
+static void connectStep(unsigned long now)
+{
+  switch (phase)
+  {
+    case MQ_IDLE:
     {
-      if (mqttReconnect())
+      if (!WiFi.isConnected())
+      {
+        attemptDone = true;   // setup() hat schon gewartet: offline, Scheduler puffert
+        return;
+      }
+      if (now < nextReconnectDue)
+      {
+        return;
+      }
+      Serial.printf("[MQTT] Connecting to broker %s:%u ...\n", MQTT_HOST, mqttPort);
+      attemptStart = now;
+      enterPhase(MQ_DNS, now);
+
+      ip_addr_t addr;
+      dnsState = 0;
+      dnsAttempt++;
+      const err_t err = dns_gethostbyname(MQTT_HOST, &addr, dnsFound, (void*)(uintptr_t)dnsAttempt);
+      if (err == ERR_OK)
       {
-        reconnectDelayMs = 5000;
-        nextReconnectDue = 0;
+        brokerIp = IPAddress(&addr);   // IP-Literal oder Cache
+        dnsState = 1;
       }
-      else
+      else if (err != ERR_INPROGRESS)
       {
-        reconnectDelayMs = min(reconnectDelayMs * 2, reconnectDelayMaxMs);
-        nextReconnectDue = now + reconnectDelayMs;
-        Serial.printf("[MQTT] Next reconnect in %lu s\n", reconnectDelayMs/1000);
+        dnsState = 2;
       }
+      return;
     }
+
+    case MQ_DNS:
+      if (dnsState == 1)
+      {
+        if (!mqttSock.connect(brokerIp, mqttPort))
+        {
+          connectFailed("tcp", MQTT_CONNECT_FAILED);
+          return;
+        }
+        enterPhase(MQ_TCP, now);
+      }
+      else if (dnsState == 2)
+      {
+        connectFailed("dns", MQTT_CONNECT_FAILED);
+      }
+      else if (now - phaseStart >= MQTT_DNS_TIMEOUT_MS)
+      {
+        dnsAttempt++;
+        connectFailed("dns", MQTT_CONNECTION_TIMEOUT);
+      }
+      return;
+
+    case MQ_TCP:
+    {
+      if (mqttSock.connecting())
+      {
+        if (now - phaseStart >= MQTT_TCP_TIMEOUT_MS)
+        {
+          connectFailed("tcp", MQTT_CONNECTION_TIMEOUT);
+        }
+        return;
+      }
+      if (!mqttSock.connected())
+      {
+        connectFailed("tcp", MQTT_CONNECT_FAILED);   // RST/abgelehnt
+        return;
+      }
+      // Socket steht: connect() sendet nur CONNECT und kehrt über den
+      // lokalen CONNACK von mqttLink sofort zurück
+      String clientId = "HeatCtrl-" + String(ESP.getChipId(), HEX);
+      mqttLink.expectConnack();
+      if (!mqttClient.connect(clientId.c_str(), MQTT_USER, MQTT_PASS))
+      {
+        connectFailed("connect", mqttClient.state());
+        return;
+      }
+      enterPhase(MQ_CONNACK, now);
+      return;
+    }
+
+    case MQ_CONNACK:
+      if (mqttSock.available() >= 4)
+      {
+        uint8_t p[4];
+        mqttSock.read(p, sizeof(p));
+        if (p[0] != 0x20 || p[1] != 0x02)
+        {
+          connectFailed("connack", MQTT_CONNECT_BAD_PROTOCOL);
+        }
+        else if (p[3] != 0)
+        {
+          connectFailed("connack", p[3]);   // 1..5 wie MQTT_CONNECT_*
+        }
+        else
+        {
+          String topic = String(BASE_TOPIC) + "/cmd";
+          mqttClient.subscribe(topic.c_str());
+          Serial.print(F("[MQTT] Subscribing to "));
+          Serial.println(topic);
+          enterPhase(MQ_SUBACK, now);
+        }
+      }
+      else if (!mqttSock.connected())
+      {
+        connectFailed("connack", MQTT_CONNECTION_LOST);
+      }
+      else if (now - phaseStart >= MQTT_CONNACK_TIMEOUT_MS)
+      {
+        connectFailed("connack", MQTT_CONNECTION_TIMEOUT);
+      }
+      return;
+
+    case MQ_SUBACK:
+      if (mqttSock.available() > 0 && mqttSock.peek() != 0x90)
+      {
+        // z.B. retained /cmd vor dem SUBACK: normal verarbeiten, aber erst
+        // wenn es ganz da ist (readPacket() würde auf den Rest warten)
+        if (packetBuffered())
+        {
+          mqttClient.loop();
+        }
+        else if (!mqttSock.connected())
+        {
+          connectFailed("suback", MQTT_CONNECTION_LOST);
+        }
+        else if (now - phaseStart >= MQTT_SUBACK_TIMEOUT_MS)
+        {
+          connectFailed("suback", MQTT_CONNECTION_TIMEOUT);
+        }
+      }
+      else if (mqttSock.available() >= 5)
+      {
+        uint8_t p[5];   // 0x90, 3, Packet-ID, Return-Code
+        mqttSock.read(p, sizeof(p));
+        if (p[4] == 0x80)
+        {
+          connectFailed("suback", MQTT_CONNECT_UNAUTHORIZED);
+        }
+        else
+        {
+          connectOnline(now);
+        }
+      }
+      else if (!mqttSock.connected())
+      {
+        connectFailed("suback", MQTT_CONNECTION_LOST);
+      }
+      else if (now - phaseStart >= MQTT_SUBACK_TIMEOUT_MS)
+      {
+        connectFailed("suback", MQTT_CONNECTION_TIMEOUT);
+      }
+      return;
+
+    case MQ_ONLINE:
+      return;
   }
-  else
+}
+
+/***************** movedPast ****************************************************
+ * params: now, last, deadband
+ * return: bool
+ * Description:
+ * True if now differs from last by at least deadband, or if exactly one of
+ * them is NaN (sensor lost / back).
+ ******************************************************************************/
+static bool movedPast(float now, float last, float deadband)
+{
+  if (isnan(now) || isnan(last))
   {
-    // connected – clear MQTT overlay, keep heartbeat
-    mqttClient.loop();
+    return isnan(now) != isnan(last);
   }
+  return fabsf(now - last) >= deadband;
 }
 
-/***************** publishTelemetry ********************************************
+/***************** captureEvent *************************************************
+ * params: e, kind
+ * return: void
  * Description:
- * Publishes current telemetry (temperature, humidity, state) via MQTT.
+ * Takes the current readings (and for QEV_STATE the config) with a
+ * getEpochOrUptimeSec() timestamp.
  ******************************************************************************/
-void publishTelemetry()
+static void captureEvent(QueuedEvent& e, QueuedEventKind kind)
 {
-  if (!mqttClient.connected())
+  const float t = getLastTemperature();
+  const float h = getLastHumidity();
+
+  memset(&e, 0, sizeof(e));
+  e.tsSec         = getEpochOrUptimeSec();
+  e.kind          = kind;
+  e.flags         = (isHeaterOn() ? 0x01 : 0x00) |
+                    (((uint8_t)getControlMode() & 0x03) << 1) |
+                    (((uint8_t)getControlState() & 0x03) << 3);
+  e.tempCenti     = isnan(t) ? INT16_MIN : (int16_t)lroundf(t * 100.0f);
+  e.humDeci       = isnan(h) ? -1 : (int16_t)lroundf(h * 10.0f);
+  e.setPointCenti = (int16_t)lroundf(getSetPoint() * 100.0f);
+
+  if (kind == QEV_STATE)
   {
-    return;
+    e.daySetPointCenti   = (int16_t)lroundf(getDaySetPoint() * 100.0f);
+    e.nightSetPointCenti = (int16_t)lroundf(getNightSetPoint() * 100.0f);
+    e.hysteresisCenti    = (int16_t)lroundf(getHysteresis() * 100.0f);
+    e.dayStartMin        = (uint16_t)getDayStartMinutes();
+    e.nightStartMin      = (uint16_t)getNightStartMinutes();
+    e.boostMinutes       = (uint16_t)getBoostMinutes();
   }
+}
+
+/***************** sendEvent ****************************************************
+ * params: e, retained
+ * return: bool
+ * Description:
+ * Formats an event as JSON ("ts" plus the usual fields) and publishes it
+ * on <BASE_TOPIC>/telemetry or /state.
+ ******************************************************************************/
+static bool sendEvent(const QueuedEvent& e, bool retained)
+{
+  const ControlMode  mode  = (ControlMode)((e.flags >> 1) & 0x03);
+  const ControlState state = (ControlState)((e.flags >> 3) & 0x03);
 
-  StaticJsonDocument<256> doc;
-  doc["temp"]     = isnan(getLastTemperature()) ? 0 : getLastTemperature();
-  doc["humidity"] = isnan(getLastHumidity()) ? 0 : getLastHumidity();
-  doc["state"]    = stateToStr(getControlState());
-  doc["mode"]     = modeToStr(getControlMode());
+  StaticJsonDocument<384> doc;
+  doc["ts"] = e.tsSec;
+  const char* suffix;
+  if (e.kind == QEV_TELEMETRY)
+  {
+    doc["temp"]     = (e.tempCenti == INT16_MIN) ? 0.0f : e.tempCenti / 100.0f;
+    doc["humidity"] = (e.humDeci < 0) ? 0.0f : e.humDeci / 10.0f;
+    doc["heater"]   = (e.flags & 0x01) != 0;
+    doc["state"]    = stateToStr(state);
+    doc["mode"]     = modeToStr(mode);
+    suffix = "/telemetry";
+  }
+  else if (e.kind == QEV_AGG)
+  {
+    doc["n"] = e.readings;
+    if (e.tempCenti != INT16_MIN)
+    {
+      doc["tMin"]  = e.tempMinCenti / 100.0f;
+      doc["tMax"]  = e.tempMaxCenti / 100.0f;
+      doc["tAvg"]  = e.tempAvgCenti / 100.0f;
+      doc["tLast"] = e.tempCenti / 100.0f;
+    }
+    if (e.humDeci >= 0)
+    {
+      doc["hMin"]  = e.humMinDeci / 10.0f;
+      doc["hMax"]  = e.humMaxDeci / 10.0f;
+      doc["hAvg"]  = e.humAvgDeci / 10.0f;
+      doc["hLast"] = e.humDeci / 10.0f;
+    }
+    doc["duty"] = e.flags;
+    suffix = "/telemetry/agg";
+  }
+  else
+  {
+    doc["setPoint"]      = e.setPointCenti / 100.0f;
+    doc["daySetPoint"]   = e.daySetPointCenti / 100.0f;
+    doc["nightSetPoint"] = e.nightSetPointCenti / 100.0f;
+    doc["dayStart"]      = e.dayStartMin;
+    doc["nightStart"]    = e.nightStartMin;
+    doc["hysteresis"]    = e.hysteresisCenti / 100.0f;
+    doc["boostMinutes"]  = e.boostMinutes;
+    doc["mode"]          = modeToStr(mode);
+    doc["state"]         = stateToStr(state);
+    suffix = "/state";
+  }
 
   String payload;
   serializeJson(doc, payload);
-  String topic = String(BASE_TOPIC) + "/telemetry";
+  String topic = String(BASE_TOPIC) + suffix;
 
-  if (mqttClient.publish(topic.c_str(), payload.c_str()))
+  if (!mqttClient.publish(topic.c_str(), payload.c_str(), retained))
+  {
+    mqttStats.publishFailures++;
+    return false;
+  }
+  mqttStats.publishes++;
+  if (e.kind == QEV_TELEMETRY)
+  {
+    mqttStats.telemetrySent++;
+  }
+  else if (e.kind == QEV_AGG)
   {
-    Serial.println(F("[MQTT] Telemetry published"));
+    mqttStats.aggSent++;
   }
   else
   {
-    Serial.println(F("[MQTT] Telemetry publish failed"));
+    mqttStats.stateSent++;
   }
+  return true;
 }
 
-/***************** publishState *************************************************
+/***************** deliverEvent *************************************************
+ * params: e
+ * return: void
  * Description:
- * Publishes controller configuration and state.
+ * Publishes live if connected and nothing is waiting (retained, except
+ * aggregates), otherwise queues the event so order is kept. A failed
+ * publish is queued as well.
  ******************************************************************************/
-void publishState()
+static void deliverEvent(const QueuedEvent& e)
 {
-  if (!mqttClient.connected())
+  if (heartbeatDue)
+  {
+    mqttStats.heartbeats++;
+  }
+  if (mqttIsConnected() && mqttQueueCount() == 0 && sendEvent(e, e.kind != QEV_AGG))
   {
     return;
   }
+  mqttQueuePush(e);
+}
 
-  StaticJsonDocument<384> doc;
-  doc["setPoint"]      = getSetPoint();
-  doc["daySetPoint"]   = getDaySetPoint();
-  doc["nightSetPoint"] = getNightSetPoint();
-  doc["dayStart"]      = getDayStartMinutes();
-  doc["nightStart"]    = getNightStartMinutes();
-  doc["hysteresis"]    = getHysteresis();
-  doc["boostMinutes"]  = getBoostMinutes();
-  doc["mode"]          = modeToStr(getControlMode());
-  doc["state"]         = stateToStr(getControlState());
+/***************** replayQueue **************************************************
+ * params: now
+ * return: void
+ * Description:
+ * Sends the oldest queued event, at most one per MQTTQ_REPLAY_INTERVAL_MS.
+ * Replayed events are not retained (they are old); once the queue is empty
+ * the current values are published retained again.
+ ******************************************************************************/
+static void replayQueue(unsigned long now)
+{
+  if (now - lastReplay < MQTTQ_REPLAY_INTERVAL_MS)
+  {
+    return;
+  }
 
-  String payload;
-  serializeJson(doc, payload);
-  String topic = String(BASE_TOPIC) + "/state";
+  QueuedEvent e;
+  if (!mqttQueuePeek(e))
+  {
+    return;
+  }
+  lastReplay = now;
+  if (!sendEvent(e, false))
+  {
+    return;   // nächster Versuch im nächsten Intervall
+  }
+  mqttQueuePop();
 
-  if (mqttClient.publish(topic.c_str(), payload.c_str()))
+  if (mqttQueueCount() == 0)
   {
-    Serial.println(F("[MQTT] State published"));
+    Serial.printf("[MQTT] Replay done (%lu events)\n", (unsigned long)getMqttQueueStats().replayed);
+    telemetrySent.valid = false;
+    stateSent.valid     = false;
+  }
+}
+
+/***************** schedulePublish **********************************************
+ * params: now
+ * return: void
+ * Description:
+ * Change-driven publishing (see mqtt.h): decides whether telemetry and/or
+ * state are due and publishes them, or queues them while disconnected.
+ * A few getter calls when nothing is due.
+ ******************************************************************************/
+static void schedulePublish(unsigned long now)
+{
+  const uint8_t mode  = (uint8_t)getControlMode();
+  const uint8_t state = (uint8_t)getControlState();
+
+  const bool telemetryChanged = !telemetrySent.valid ||
+                                telemetrySent.heater != isHeaterOn() ||
+                                telemetrySent.mode != mode ||
+                                telemetrySent.state != state;
+  const bool telemetryMoved = movedPast(getLastTemperature(), telemetrySent.temp, MQTT_TEMP_DEADBAND_C) ||
+                              movedPast(getLastHumidity(), telemetrySent.hum, MQTT_HUM_DEADBAND_PCT);
+  const unsigned long telemetryAge = now - lastTelemetryPublish;
+
+  if ((telemetryChanged && telemetryAge >= publishGapMs) ||
+      (telemetryMoved && telemetryAge >= MQTT_MIN_INTERVAL_MS) ||
+      telemetryAge >= MQTT_HEARTBEAT_MS)
+  {
+    heartbeatDue = !telemetryChanged && !telemetryMoved;
+    publishTelemetry();
+  }
+
+  const bool stateChanged = !stateSent.valid ||
+                            stateSent.configVersion != getConfigVersion() ||
+                            stateSent.setPointDeci != (int16_t)lroundf(getSetPoint() * 10.0f) ||
+                            stateSent.mode != mode ||
+                            stateSent.state != state;
+
+  const unsigned long stateAge = now - lastStatePublish;
+  if ((stateChanged && stateAge >= publishGapMs) || stateAge >= MQTT_HEARTBEAT_MS)
+  {
+    heartbeatDue = !stateChanged;
+    publishState();
+  }
+  heartbeatDue = false;
+}
+
+/***************** ensureMQTT ***************************************************
+ * Description:
+ * Ensures MQTT connection is alive.
+ * Disconnected: one step of the connect state machine (exponential backoff
+ * between attempts). Connected: client loop and backlog replay.
+ ******************************************************************************/
+void ensureMQTT()
+{
+  if (phase != MQ_ONLINE)
+  {
+    connectStep(millis());
   }
   else
   {
-    Serial.println(F("[MQTT] State publish failed"));
+    mqttClient.loop();
+    if (mqttClient.connected())
+    {
+      replayQueue(millis());
+    }
+    else
+    {
+      connError = mqttClient.state();
+      enterPhase(MQ_IDLE, millis());   // sofort neu verbinden
+      Serial.println(F("[MQTT] Connection lost"));
+    }
   }
+
+  // läuft auch offline: Events landen dann in der Queue. Während eines
+  // Verbindungsaufbaus warten, Änderungen gehen danach live raus; nach dem
+  // Boot erst, wenn der erste Versuch durch ist (sonst würde der erste
+  // Stand gepuffert und nach dem Connect doppelt gesendet).
+  if (phase == MQ_ONLINE || (phase == MQ_IDLE && attemptDone))
+  {
+    schedulePublish(millis());
+  }
+
+  // Aggregate sammeln immer, ohne Verbindung gehen sie in die Queue
+  QueuedEvent agg;
+  if (pollMqttAgg(agg))
+  {
+    deliverEvent(agg);
+  }
+
+  // RAM-Teil der Queue nicht beliebig lange ungesichert lassen
+  mqttQueueTick();
+}
+
+/***************** publishTelemetry ********************************************
+ * Description:
+ * Publishes current telemetry (temperature, humidity, heater, state),
+ * queued while disconnected.
+ ******************************************************************************/
+void publishTelemetry()
+{
+  QueuedEvent e;
+  captureEvent(e, QEV_TELEMETRY);
+  lastTelemetryPublish = millis();
+  deliverEvent(e);
+
+  telemetrySent.valid  = true;
+  telemetrySent.temp   = getLastTemperature();
+  telemetrySent.hum    = getLastHumidity();
+  telemetrySent.heater = isHeaterOn();
+  telemetrySent.mode   = (uint8_t)getControlMode();
+  telemetrySent.state  = (uint8_t)getControlState();
+}
+
+/***************** publishState *************************************************
+ * Description:
+ * Publishes controller configuration and state, queued while disconnected.
+ ******************************************************************************/
+void publishState()
+{
+  QueuedEvent e;
+  captureEvent(e, QEV_STATE);
+  lastStatePublish = millis();
+  deliverEvent(e);
+
+  stateSent.valid         = true;
+  stateSent.configVersion = getConfigVersion();
+  stateSent.setPointDeci  = (int16_t)lroundf(getSetPoint() * 10.0f);
+  stateSent.mode          = (uint8_t)getControlMode();
+  stateSent.state         = (uint8_t)getControlState();
 }
 
 /***************** initMqtt *****************************************************
@@ -187,11 +772,17 @@ void publishState()
  ******************************************************************************/
 void initMqtt()
 {
-  mqttClient.setServer(MQTT_HOST, 1883);
+  mqttClient.setServer(MQTT_HOST, mqttPort);
   mqttClient.setCallback(mqttCallback);
   Serial.println(F("[MQTT] Initialized"));
 }
 
+/***************** getMqttStats *************************************************/
+const MqttStats& getMqttStats()
+{
+  return mqttStats;
+}
+
 /***************** mqttIsConnected *********************************************
  * params: none
  * return: bool
@@ -200,18 +791,28 @@ void initMqtt()
  ******************************************************************************/
 bool mqttIsConnected()
 {
-  return mqttClient.connected();
+  return phase == MQ_ONLINE && mqttClient.connected();
 }
 
 /***************** mqttConnStateText ********************************************
  * params: none
  * return: const char*
  * Description:
- * Maps PubSubClient::state() to a human-readable short string.
+ * Maps the connect phase, or PubSubClient::state() / the reason of the last
+ * failed attempt, to a human-readable short string.
  ******************************************************************************/
 const char* mqttConnStateText()
 {
-  int s = mqttClient.state();
+  switch (phase)
+  {
+    case MQ_DNS:     return "resolving";
+    case MQ_TCP:
+    case MQ_CONNACK: return "connecting";
+    case MQ_SUBACK:  return "subscribing";
+    default:         break;
+  }
+
+  int s = (phase == MQ_ONLINE) ? mqttClient.state() : connError;
   switch (s)
   {
     case MQTT_CONNECTED:               return "connected";
@@ -1,26 +1,115 @@
 #ifndef MQTT_H
 #define MQTT_H
 
+#include <Arduino.h>
+
+/***************** Publish scheduler ********************************************
+ * Description:
+ * Telemetry is sent when the temperature (humidity) moved at least
+ * MQTT_TEMP_DEADBAND_C (MQTT_HUM_DEADBAND_PCT) from the last published
+ * value, at most every MQTT_MIN_INTERVAL_MS, and immediately when heater,
+ * mode or state change. State is sent on every config change and on mode,
+ * state or effective set point changes. Both are repeated after
+ * MQTT_HEARTBEAT_MS without change and are published retained. Every
+ * message carries "ts" (getEpochOrUptimeSec()).
+ ******************************************************************************/
+#ifndef MQTT_TEMP_DEADBAND_C
+#define MQTT_TEMP_DEADBAND_C 0.2f
+#endif
+
+#ifndef MQTT_HUM_DEADBAND_PCT
+#define MQTT_HUM_DEADBAND_PCT 2.0f
+#endif
+
+#ifndef MQTT_MIN_INTERVAL_MS
+#define MQTT_MIN_INTERVAL_MS 10000UL
+#endif
+
+#ifndef MQTT_HEARTBEAT_MS
+#define MQTT_HEARTBEAT_MS 300000UL
+#endif
+
+/***************** Connect timeouts *********************************************
+ * Description:
+ * The broker connection is set up by a state machine in ensureMQTT(), one
+ * step per loop(): DNS (asynchronous), TCP connect, CONNECT/CONNACK and
+ * SUBSCRIBE/SUBACK, each with its own timeout. A timeout or refusal closes
+ * the socket and schedules the next attempt with exponential backoff.
+ * No step waits: DNS and TCP connect (raw lwIP, see TcpClient) report
+ * through callbacks, the replies are polled in the socket buffer.
+ ******************************************************************************/
+#ifndef MQTT_DNS_TIMEOUT_MS
+#define MQTT_DNS_TIMEOUT_MS 4000UL
+#endif
+
+#ifndef MQTT_TCP_TIMEOUT_MS
+#define MQTT_TCP_TIMEOUT_MS 4000UL
+#endif
+
+#ifndef MQTT_CONNACK_TIMEOUT_MS
+#define MQTT_CONNACK_TIMEOUT_MS 4000UL
+#endif
+
+#ifndef MQTT_SUBACK_TIMEOUT_MS
+#define MQTT_SUBACK_TIMEOUT_MS 4000UL
+#endif
+
 /***************** initMqtt *****************************************************
  * Initializes MQTT client and sets up callback handler.
  ******************************************************************************/
 void initMqtt();
 
 /***************** ensureMQTT *************************************************
- * Ensures MQTT connection is alive, reconnects every 10s if disconnected.
+ * Ensures MQTT connection is alive: advances the connect state machine by
+ * one step while disconnected (see Connect timeouts), services the client
+ * while connected. Runs the publish scheduler when online or idle, not
+ * during a connect attempt and not before the first one after boot has
+ * finished (see above).
  ******************************************************************************/
 void ensureMQTT();
 
 /***************** publishTelemetry ********************************************
  * Publishes current sensor data (temp, humidity, state) to MQTT broker.
+ * While disconnected (or while a backlog is replayed) the message is queued
+ * with its timestamp instead, see mqttqueue.h.
  ******************************************************************************/
 void publishTelemetry();
 
 /***************** publishState *************************************************
  * Publishes current configuration and control state (setPoint, mode, etc.).
+ * Queued like publishTelemetry().
  ******************************************************************************/
 void publishState();
 
+/***************** MqttStats ****************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Connection and publish counters since boot.
+ ******************************************************************************/
+struct MqttStats
+{
+  uint32_t reconnects;        // erfolgreiche Verbindungsaufbauten
+  uint32_t connectFailures;
+  uint32_t publishes;
+  uint32_t publishFailures;
+  uint32_t telemetrySent;     // davon Telemetrie
+  uint32_t stateSent;         // davon State
+  uint32_t heartbeats;        // davon nur wegen MQTT_HEARTBEAT_MS
+  uint32_t aggSent;           // Aggregate (/telemetry/agg, siehe mqttagg.h)
+  uint32_t commands;          // empfangene /cmd-Nachrichten
+  uint32_t commandErrors;     // davon verworfen (JSON/Feld ungültig)
+  uint32_t commandCommits;    // EEPROM-Commits durch Kommandos (max. 1 je Kommando)
+};
+
+/***************** getMqttStats *************************************************
+ * params: none
+ * return: const MqttStats&
+ * Description:
+ * Returns the MQTT counters.
+ ******************************************************************************/
+const MqttStats& getMqttStats();
+
 /***************** mqttIsConnected *********************************************
  * params: none
  * return: bool
@@ -33,8 +122,9 @@ bool mqttIsConnected();
  * params: none
  * return: const char*
  * Description:
- * Returns a short text for the last MQTT connection state
- * (e.g. "connected", "timeout", "unauthorized").
+ * Returns a short text for the current connect phase or the last MQTT
+ * connection state (e.g. "connecting", "connected", "timeout",
+ * "unauthorized").
  ******************************************************************************/
 const char* mqttConnStateText();
 
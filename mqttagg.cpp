@@ -0,0 +1,136 @@
+#include "mqttagg.h"
+#include "config.h"
+#include "control.h"
+#include "sensor.h"
+#include "ntp.h"
+
+struct AggWindow
+{
+  uint16_t readings;   // Messungen im Fenster (auch NaN)
+  uint16_t tempN;      // davon mit gültiger Temperatur
+  uint16_t humN;       // davon mit gültiger Feuchte
+  int16_t  tempMin, tempMax, tempLast;   // °C * 100
+  int16_t  humMin, humMax, humLast;      // % * 10
+  int32_t  tempSum;
+  int32_t  humSum;
+  uint32_t startMs;
+  uint32_t onMs;       // Heizzeit im Fenster
+};
+
+static AggWindow win        = {};
+static bool      active     = false;
+static bool      heaterWas  = false;
+static uint32_t  lastTickMs = 0;
+static uint32_t  lastReads  = 0;
+
+static void resetWindow(uint32_t now)
+{
+  memset(&win, 0, sizeof(win));
+  win.startMs = now;
+}
+
+// gerundeter Mittelwert, auch für negative Summen
+static int16_t roundedAvg(int32_t sum, uint16_t n)
+{
+  const int32_t half = n / 2;
+  return (int16_t)((sum >= 0 ? sum + half : sum - half) / (int32_t)n);
+}
+
+/***************** addReading ***************************************************
+ * params: t, h
+ * return: void
+ * Description:
+ * Adds one sensor reading; NaN values count as reading but not to the stats.
+ ******************************************************************************/
+static void addReading(float t, float h)
+{
+  win.readings++;
+  if (!isnan(t))
+  {
+    const int16_t v = (int16_t)lroundf(t * 100.0f);
+    win.tempMin  = (win.tempN == 0 || v < win.tempMin) ? v : win.tempMin;
+    win.tempMax  = (win.tempN == 0 || v > win.tempMax) ? v : win.tempMax;
+    win.tempLast = v;
+    win.tempSum += v;
+    win.tempN++;
+  }
+  if (!isnan(h))
+  {
+    const int16_t v = (int16_t)lroundf(h * 10.0f);
+    win.humMin  = (win.humN == 0 || v < win.humMin) ? v : win.humMin;
+    win.humMax  = (win.humN == 0 || v > win.humMax) ? v : win.humMax;
+    win.humLast = v;
+    win.humSum += v;
+    win.humN++;
+  }
+}
+
+/***************** pollMqttAgg **************************************************/
+bool pollMqttAgg(QueuedEvent& e)
+{
+  const uint32_t now   = millis();
+  const uint32_t reads = getSensorReadCount();
+  const uint16_t n     = (uint16_t)getAggReadings();
+
+  if (n == 0)
+  {
+    active    = false;
+    lastReads = reads;
+    return false;
+  }
+  if (!active)
+  {
+    // eingeschaltet: Fenster beginnt jetzt, mit der nächsten Messung
+    active     = true;
+    heaterWas  = isHeaterOn();
+    lastTickMs = now;
+    lastReads  = reads;
+    resetWindow(now);
+    return false;
+  }
+
+  // Heizzeit seit dem letzten Aufruf, der Zustand galt bis jetzt
+  if (heaterWas)
+  {
+    win.onMs += now - lastTickMs;
+  }
+  heaterWas  = isHeaterOn();
+  lastTickMs = now;
+
+  if (reads == lastReads)
+  {
+    return false;
+  }
+  lastReads = reads;
+  addReading(getLastTemperature(), getLastHumidity());
+  if (win.readings < n)
+  {
+    return false;
+  }
+
+  const uint32_t spanMs = now - win.startMs;
+  const uint32_t duty = (spanMs > 0) ? (win.onMs * 100UL + spanMs / 2) / spanMs : 0;
+
+  memset(&e, 0, sizeof(e));
+  e.tsSec     = getEpochOrUptimeSec();
+  e.kind      = QEV_AGG;
+  e.flags     = (uint8_t)(duty > 100 ? 100 : duty);
+  e.readings  = win.readings;
+  e.tempCenti = (win.tempN > 0) ? win.tempLast : INT16_MIN;
+  e.humDeci   = (win.humN > 0) ? win.humLast : -1;
+  if (win.tempN > 0)
+  {
+    e.tempMinCenti = win.tempMin;
+    e.tempMaxCenti = win.tempMax;
+    e.tempAvgCenti = roundedAvg(win.tempSum, win.tempN);
+  }
+  if (win.humN > 0)
+  {
+    e.humMinDeci = win.humMin;
+    e.humMaxDeci = win.humMax;
+    e.humAvgDeci = roundedAvg(win.humSum, win.humN);
+  }
+
+  resetWindow(now);
+  return true;
+}
@@ -0,0 +1,30 @@
+#ifndef MQTTAGG_H
+#define MQTTAGG_H
+
+#include <Arduino.h>
+#include "mqttqueue.h"
+
+/***************** Aggregate telemetry ******************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * With aggReadings = N > 0 (config: /api/config or MQTT cmd) every N sensor
+ * readings are folded into one message on <BASE_TOPIC>/telemetry/agg:
+ * min/max/avg/last of temperature and humidity over the window and the
+ * heater duty (on-time / window time). At 5 s per reading, N = 12 gives one
+ * message per minute. Aggregates are not retained and are queued while
+ * offline like telemetry (see mqttqueue.h). 0 = off.
+ ******************************************************************************/
+
+/***************** pollMqttAgg **************************************************
+ * params: e
+ * return: bool
+ * Description:
+ * Call every loop(). Accumulates heater on-time, adds each new sensor
+ * reading to the window and returns true with e filled (QEV_AGG) when the
+ * window holds N readings. Changing N applies from the next reading;
+ * switching off drops the partial window.
+ ******************************************************************************/
+bool pollMqttAgg(QueuedEvent& e);
+
+#endif // MQTTAGG_H
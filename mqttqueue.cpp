@@ -0,0 +1,312 @@
+#include "mqttqueue.h"
+#include <LittleFS.h>
+
+static const uint32_t MQTTQ_MAGIC     = 0x3251514DUL;  // "MQQ2" (MQQ1 ohne head wird verworfen)
+static const uint32_t MQTTQ_EPOCH_MIN = 1609459200UL; // wie validEpoch() in ntp.cpp
+static const char*    MQTTQ_TMP_PATH  = MQTTQ_FILE_PATH ".tmp";
+
+struct QueueFileHeader
+{
+  uint32_t magic;
+  uint16_t recSize;
+  uint16_t reserved;
+  uint32_t head;       // erster noch nicht gesendeter Record (Stand der letzten syncHead())
+};
+
+static QueuedEvent    ram[MQTTQ_RAM_RECORDS];
+static size_t         ramHead  = 0;   // ältestes Event im RAM
+static size_t         ramCount = 0;
+static unsigned long  ramSinceMs = 0; // millis() beim ersten Event im leeren RAM
+
+static File           qFile;
+static uint32_t       fileCount = 0;  // Records in der Datei
+static uint32_t       fileHead  = 0;  // nächster zu sendender Record
+static uint32_t       fileBoot  = 0;  // Records aus dem vorigen Boot
+static MqttQueueStats qStats    = {};
+
+static uint32_t recOffset(uint32_t index)
+{
+  return sizeof(QueueFileHeader) + index * sizeof(QueuedEvent);
+}
+
+/***************** syncHead *****************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Persists the replay position in the file header, so a reboot during
+ * replay resumes there instead of sending the file again.
+ ******************************************************************************/
+static void syncHead()
+{
+  qFile.seek(offsetof(QueueFileHeader, head), SeekSet);
+  qFile.write((const uint8_t*)&fileHead, sizeof(fileHead));
+  qFile.flush();
+}
+
+/***************** resetFile ****************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Closes and deletes the spill file (fully replayed or unusable).
+ ******************************************************************************/
+static void resetFile()
+{
+  if (qFile)
+  {
+    qFile.close();
+  }
+  LittleFS.remove(MQTTQ_FILE_PATH);
+  fileCount = 0;
+  fileHead  = 0;
+  fileBoot  = 0;
+}
+
+/***************** initMqttQueue ************************************************/
+void initMqttQueue()
+{
+  if (!LittleFS.exists(MQTTQ_FILE_PATH))
+  {
+    return;
+  }
+
+  qFile = LittleFS.open(MQTTQ_FILE_PATH, "r+");
+  QueueFileHeader h;
+  if (!qFile || qFile.read((uint8_t*)&h, sizeof(h)) != sizeof(h) ||
+      h.magic != MQTTQ_MAGIC || h.recSize != sizeof(QueuedEvent))
+  {
+    resetFile();
+    return;
+  }
+
+  // abgeschnittenen letzten Record (Stromausfall beim Spill) ignorieren
+  fileCount = (qFile.size() - sizeof(h)) / sizeof(QueuedEvent);
+  fileBoot  = fileCount;
+  if (h.head >= fileCount)
+  {
+    resetFile();
+    return;
+  }
+  fileHead = h.head;
+  Serial.printf("[MQTTQ] Resumed %s, %lu events (%lu already sent)\n", MQTTQ_FILE_PATH,
+                (unsigned long)(fileCount - fileHead), (unsigned long)fileHead);
+}
+
+/***************** compactFile **************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Rewrites the spill file without the records already sent, so a partly
+ * replayed file does not grow towards MQTTQ_FILE_RECORDS. The copy goes to
+ * a temporary file that replaces the old one by rename; a power loss
+ * leaves either file intact.
+ ******************************************************************************/
+static bool compactFile()
+{
+  const uint32_t live = fileCount - fileHead;
+  File tmp = LittleFS.open(MQTTQ_TMP_PATH, "w+");
+  const QueueFileHeader h = { MQTTQ_MAGIC, (uint16_t)sizeof(QueuedEvent), 0, 0 };
+  bool ok = tmp && tmp.write((const uint8_t*)&h, sizeof(h)) == sizeof(h);
+
+  QueuedEvent buf[16];
+  for (uint32_t done = 0; ok && done < live; )
+  {
+    uint32_t n = live - done;
+    if (n > 16) n = 16;
+    const size_t bytes = n * sizeof(QueuedEvent);
+    qFile.seek(recOffset(fileHead + done), SeekSet);
+    ok = qFile.read((uint8_t*)buf, bytes) == bytes &&
+         tmp.write((const uint8_t*)buf, bytes) == bytes;
+    done += n;
+  }
+  if (tmp)
+  {
+    tmp.close();
+  }
+
+  qFile.close();
+  if (!ok || !LittleFS.rename(MQTTQ_TMP_PATH, MQTTQ_FILE_PATH))
+  {
+    LittleFS.remove(MQTTQ_TMP_PATH);
+    qFile = LittleFS.open(MQTTQ_FILE_PATH, "r+");
+    return false;
+  }
+
+  qFile     = LittleFS.open(MQTTQ_FILE_PATH, "r+");
+  fileBoot  = (fileBoot > fileHead) ? fileBoot - fileHead : 0;
+  fileCount = live;
+  fileHead  = 0;
+  Serial.printf("[MQTTQ] Compacted %s to %lu events\n", MQTTQ_FILE_PATH, (unsigned long)live);
+  return (bool)qFile;
+}
+
+/***************** spillRam *****************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Appends the whole RAM ring to the spill file in one write.
+ ******************************************************************************/
+static bool spillRam()
+{
+  if (fileCount - fileHead + ramCount > MQTTQ_FILE_RECORDS)
+  {
+    return false;
+  }
+  if (fileCount + ramCount > MQTTQ_FILE_RECORDS && !compactFile())
+  {
+    qStats.spillErrors++;
+    return false;
+  }
+
+  if (!qFile)
+  {
+    qFile = LittleFS.open(MQTTQ_FILE_PATH, "w+");
+    const QueueFileHeader h = { MQTTQ_MAGIC, (uint16_t)sizeof(QueuedEvent), 0, 0 };
+    if (!qFile || qFile.write((const uint8_t*)&h, sizeof(h)) != sizeof(h))
+    {
+      qStats.spillErrors++;
+      resetFile();
+      return false;
+    }
+  }
+
+  // Ring linearisieren: ab ramHead bis Ende, dann der umgebrochene Teil
+  const size_t first = (ramHead + ramCount <= MQTTQ_RAM_RECORDS) ? ramCount : MQTTQ_RAM_RECORDS - ramHead;
+  const size_t bytes1 = first * sizeof(QueuedEvent);
+  const size_t bytes2 = (ramCount - first) * sizeof(QueuedEvent);
+
+  qFile.seek(recOffset(fileCount), SeekSet);
+  if (qFile.write((const uint8_t*)&ram[ramHead], bytes1) != bytes1 ||
+      qFile.write((const uint8_t*)&ram[0], bytes2) != bytes2)
+  {
+    qStats.spillErrors++;
+    qFile.seek(recOffset(fileCount), SeekSet);
+    qFile.truncate(recOffset(fileCount));
+    return false;
+  }
+  qFile.flush();
+
+  fileCount += ramCount;
+  ramHead  = 0;
+  ramCount = 0;
+  qStats.spills++;
+  return true;
+}
+
+/***************** mqttQueuePush ************************************************/
+bool mqttQueuePush(const QueuedEvent& e)
+{
+  if (ramCount == MQTTQ_RAM_RECORDS && !spillRam())
+  {
+    qStats.dropped++;
+    return false;
+  }
+
+  if (ramCount == 0)
+  {
+    ramSinceMs = millis();
+  }
+  ram[(ramHead + ramCount) % MQTTQ_RAM_RECORDS] = e;
+  ramCount++;
+  qStats.queued++;
+  return true;
+}
+
+/***************** mqttQueueTick ************************************************/
+void mqttQueueTick()
+{
+  const unsigned long now = millis();
+  if (ramCount > 0 &&
+      now - ramSinceMs >= (unsigned long)MQTTQ_RAM_MAX_AGE_MIN * 60000UL)
+  {
+    if (!spillRam())
+    {
+      ramSinceMs = now;   // Datei voll/Fehler: nicht in jedem loop() neu versuchen
+    }
+  }
+}
+
+/***************** flushMqttQueue ***********************************************/
+bool flushMqttQueue()
+{
+  return ramCount == 0 || spillRam();
+}
+
+/***************** dropFront ****************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Removes the oldest event (file first, then RAM).
+ ******************************************************************************/
+static void dropFront()
+{
+  if (fileHead < fileCount)
+  {
+    if (++fileHead == fileCount)
+    {
+      resetFile();
+    }
+    else if (fileHead % MQTTQ_HEAD_SYNC_RECORDS == 0)
+    {
+      syncHead();
+    }
+    return;
+  }
+
+  if (ramCount > 0)
+  {
+    ramHead = (ramHead + 1) % MQTTQ_RAM_RECORDS;
+    ramCount--;
+  }
+}
+
+/***************** mqttQueuePeek ************************************************/
+bool mqttQueuePeek(QueuedEvent& e)
+{
+  while (fileHead < fileCount)
+  {
+    qFile.seek(recOffset(fileHead), SeekSet);
+    if (qFile.read((uint8_t*)&e, sizeof(e)) != sizeof(e))
+    {
+      // Datei kaputt: Rest verwerfen, RAM-Teil bleibt gültig
+      qStats.dropped += fileCount - fileHead;
+      resetFile();
+      break;
+    }
+    if (fileHead < fileBoot && e.tsSec < MQTTQ_EPOCH_MIN)
+    {
+      qStats.dropped++;
+      dropFront();
+      continue;
+    }
+    return true;
+  }
+
+  if (ramCount == 0)
+  {
+    return false;
+  }
+  e = ram[ramHead];
+  return true;
+}
+
+/***************** mqttQueuePop *************************************************/
+void mqttQueuePop()
+{
+  if (mqttQueueCount() > 0)
+  {
+    dropFront();
+    qStats.replayed++;
+  }
+}
+
+/***************** mqttQueueCount ***********************************************/
+size_t mqttQueueCount()
+{
+  return (fileCount - fileHead) + ramCount;
+}
+
+/***************** getMqttQueueStats ********************************************/
+const MqttQueueStats& getMqttQueueStats()
+{
+  return qStats;
+}
@@ -0,0 +1,185 @@
+#ifndef MQTTQUEUE_H
+#define MQTTQUEUE_H
+
+#include <Arduino.h>
+
+/***************** Configuration ************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * Store-and-forward queue for telemetry/state while MQTT is down.
+ * MQTTQ_RAM_RECORDS events are buffered in RAM (24 B each); when full, after
+ * MQTTQ_RAM_MAX_AGE_MIN or on OTA start they are appended to MQTTQ_FILE_PATH
+ * in one write, up to MQTTQ_FILE_RECORDS events (48 KB). After a reconnect the backlog is replayed oldest first,
+ * one event per MQTTQ_REPLAY_INTERVAL_MS. The replay position is written to
+ * the file header every MQTTQ_HEAD_SYNC_RECORDS events: after a reboot
+ * during replay at most that many are sent twice.
+ ******************************************************************************/
+#ifndef MQTTQ_RAM_RECORDS
+#define MQTTQ_RAM_RECORDS 32
+#endif
+
+#ifndef MQTTQ_RAM_MAX_AGE_MIN
+#define MQTTQ_RAM_MAX_AGE_MIN 15
+#endif
+
+#ifndef MQTTQ_FILE_RECORDS
+#define MQTTQ_FILE_RECORDS 2048
+#endif
+
+#ifndef MQTTQ_FILE_PATH
+#define MQTTQ_FILE_PATH "/mqttq.bin"
+#endif
+
+#ifndef MQTTQ_REPLAY_INTERVAL_MS
+#define MQTTQ_REPLAY_INTERVAL_MS 50UL
+#endif
+
+#ifndef MQTTQ_HEAD_SYNC_RECORDS
+#define MQTTQ_HEAD_SYNC_RECORDS 32
+#endif
+
+/***************** QueuedEvent **************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * One telemetry, state or aggregate message as values, 24 bytes. The JSON
+ * is built at send time, so live and replayed messages look the same.
+ * - tsSec         : getEpochOrUptimeSec() when the event was taken
+ * - kind          : QEV_TELEMETRY / QEV_STATE / QEV_AGG
+ * - flags         : bit0 heater, bit1-2 ControlMode, bit3-4 ControlState;
+ *                   QEV_AGG: heater duty in percent
+ * - tempCenti     : temperature * 100, INT16_MIN = no reading (QEV_AGG: last)
+ * - humDeci       : relative humidity * 10, -1 = no reading (QEV_AGG: last)
+ * - setPointCenti : effective set point * 100
+ * - remaining     : config fields (state events only), or the window
+ *                   min/max/avg and reading count (QEV_AGG)
+ ******************************************************************************/
+enum QueuedEventKind : uint8_t
+{
+  QEV_TELEMETRY = 1,
+  QEV_STATE     = 2,
+  QEV_AGG       = 3
+};
+
+struct QueuedEvent
+{
+  uint32_t tsSec;
+  uint8_t  kind;
+  uint8_t  flags;
+  int16_t  tempCenti;
+  int16_t  humDeci;
+  union
+  {
+    struct   // QEV_TELEMETRY, QEV_STATE
+    {
+      int16_t  setPointCenti;
+      int16_t  daySetPointCenti;
+      int16_t  nightSetPointCenti;
+      int16_t  hysteresisCenti;
+      uint16_t dayStartMin;
+      uint16_t nightStartMin;
+      uint16_t boostMinutes;
+    };
+    struct   // QEV_AGG
+    {
+      int16_t  tempMinCenti;
+      int16_t  tempMaxCenti;
+      int16_t  tempAvgCenti;
+      int16_t  humMinDeci;
+      int16_t  humMaxDeci;
+      int16_t  humAvgDeci;
+      uint16_t readings;
+    };
+  };
+};
+static_assert(sizeof(QueuedEvent) == 24, "spill file record size");
+
+/***************** MqttQueueStats ***********************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Queue counters since boot.
+ ******************************************************************************/
+struct MqttQueueStats
+{
+  uint32_t queued;        // angenommene Events
+  uint32_t replayed;      // nach Reconnect gesendet
+  uint32_t dropped;       // Queue voll / Uptime-Stempel eines früheren Boots
+  uint32_t spills;        // RAM -> Datei
+  uint32_t spillErrors;
+};
+
+/***************** initMqttQueue ************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Picks up a spill file left by the previous boot (LittleFS must be mounted,
+ * see initHistory()) at its persisted replay position. Its uptime-stamped
+ * events are dropped on replay since their time base is gone.
+ ******************************************************************************/
+void initMqttQueue();
+
+/***************** mqttQueuePush ************************************************
+ * params: e
+ * return: bool
+ * Description:
+ * Appends an event; spills the RAM ring to flash when it is full, first
+ * compacting away already sent records if the file is at its size limit.
+ * Returns false (event dropped) when RAM and file are both full.
+ ******************************************************************************/
+bool mqttQueuePush(const QueuedEvent& e);
+
+/***************** mqttQueueTick ************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Spills the RAM ring once its oldest event is MQTTQ_RAM_MAX_AGE_MIN old,
+ * so a power loss while offline loses at most that much. Call from loop().
+ ******************************************************************************/
+void mqttQueueTick();
+
+/***************** flushMqttQueue ***********************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Spills the RAM ring now (before OTA / reboot). True if RAM is empty
+ * afterwards.
+ ******************************************************************************/
+bool flushMqttQueue();
+
+/***************** mqttQueuePeek ************************************************
+ * params: e
+ * return: bool
+ * Description:
+ * Oldest queued event (file first, then RAM). False if the queue is empty.
+ ******************************************************************************/
+bool mqttQueuePeek(QueuedEvent& e);
+
+/***************** mqttQueuePop *************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Removes the event returned by the last mqttQueuePeek() after it was sent
+ * (counted as replayed). Deletes the spill file once it has been replayed
+ * completely.
+ ******************************************************************************/
+void mqttQueuePop();
+
+/***************** mqttQueueCount ***********************************************
+ * params: none
+ * return: size_t
+ * Description:
+ * Number of events waiting (file + RAM).
+ ******************************************************************************/
+size_t mqttQueueCount();
+
+/***************** getMqttQueueStats ********************************************
+ * params: none
+ * return: const MqttQueueStats&
+ * Description:
+ * Returns the queue counters.
+ ******************************************************************************/
+const MqttQueueStats& getMqttQueueStats();
+
+#endif // MQTTQUEUE_H
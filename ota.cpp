@@ -1,5 +1,7 @@
 #include "ota.h"
 #include "config.h"
+#include "history.h"
+#include "mqttqueue.h"
 #include <ArduinoOTA.h>
 
 static volatile bool g_otaActive = false;
@@ -16,6 +18,10 @@ void initOta()
   ArduinoOTA.onStart([]()
   {
     g_otaActive = true;
+    // Gestagte Verlaufsdaten und Offline-Queue sichern, nach dem Update
+    // folgt ein Reboot
+    flushHistory();
+    flushMqttQueue();
     // Optional: hier ggf. kurz Dinge drosseln (MQTT publish stoppen etc.)
     Serial.println(F("[OTA] Start (fast-path engaged)"));
   });
@@ -0,0 +1,254 @@
+#include "phases.h"
+#include "config.h"
+#include "ntp.h"
+#include "sensor.h"
+#include <LittleFS.h>
+
+struct PhaseHeader
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recSize;
+  uint32_t capacity;   // Anzahl Events
+  uint32_t head;       // nächste Schreibposition (0..capacity-1)
+  uint32_t count;      // gültige Anzahl
+  uint32_t seq;        // laufende Nummer des nächsten Events
+};
+
+static const uint32_t PHASES_MAGIC   = 0x48504853UL; // "HPHS"
+static const uint16_t PHASES_VERSION = 1;
+static const uint32_t EPOCH_MIN      = 1609459200UL; // wie validEpoch() in ntp.cpp
+
+static File        phaseFile;
+static PhaseHeader phdr;
+
+static inline size_t recOffset(uint32_t idx)
+{
+  return sizeof(PhaseHeader) + (size_t)idx * sizeof(HeaterEvent);
+}
+
+static inline uint32_t slotOf(uint32_t seq)
+{
+  return (phdr.head + phdr.capacity - (phdr.seq - seq)) % phdr.capacity;
+}
+
+/***************** readEvent ****************************************************/
+static bool readEvent(uint32_t seq, HeaterEvent& out)
+{
+  phaseFile.seek(recOffset(slotOf(seq)), SeekSet);
+  return phaseFile.read((uint8_t*)&out, sizeof(out)) == sizeof(out);
+}
+
+/***************** initPhaseLog *************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Resumes the event ring if its header validates, otherwise creates it.
+ ******************************************************************************/
+bool initPhaseLog()
+{
+  const size_t total = recOffset(PHASES_RECORDS);
+
+  if (LittleFS.exists(PHASES_FILE_PATH))
+  {
+    phaseFile = LittleFS.open(PHASES_FILE_PATH, "r+");
+    if (phaseFile)
+    {
+      PhaseHeader h;
+      phaseFile.seek(0, SeekSet);
+      const bool ok = phaseFile.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+                      h.magic == PHASES_MAGIC && h.version == PHASES_VERSION &&
+                      h.recSize == sizeof(HeaterEvent) && h.capacity == PHASES_RECORDS &&
+                      h.head < h.capacity && h.count <= h.capacity && h.seq >= h.count &&
+                      phaseFile.size() >= total;
+      if (ok)
+      {
+        phdr = h;
+        Serial.printf("[PHASE] Resumed %s count=%lu\n", PHASES_FILE_PATH, (unsigned long)phdr.count);
+        return true;
+      }
+      phaseFile.close();
+    }
+    LittleFS.remove(PHASES_FILE_PATH);
+  }
+
+  phaseFile = LittleFS.open(PHASES_FILE_PATH, "w+");
+  if (!phaseFile)
+  {
+    Serial.println(F("[PHASE] Create file failed"));
+    return false;
+  }
+
+  phdr.magic    = PHASES_MAGIC;
+  phdr.version  = PHASES_VERSION;
+  phdr.recSize  = sizeof(HeaterEvent);
+  phdr.capacity = PHASES_RECORDS;
+  phdr.head     = 0;
+  phdr.count    = 0;
+  phdr.seq      = 0;
+
+  phaseFile.seek(0, SeekSet);
+  phaseFile.write((const uint8_t*)&phdr, sizeof(phdr));
+  phaseFile.seek(total - 1, SeekSet);
+  phaseFile.write((const uint8_t*)"\0", 1);
+  phaseFile.flush();
+
+  Serial.printf("[PHASE] Created %s capacity=%lu\n", PHASES_FILE_PATH, (unsigned long)phdr.capacity);
+  return true;
+}
+
+/***************** logHeaterEdge ************************************************
+ * params: on, cause
+ * return: void
+ * Description:
+ * One record + header per edge; edges are rare, so no staging.
+ ******************************************************************************/
+void logHeaterEdge(bool on, HeaterCause cause)
+{
+  if (!phaseFile)
+  {
+    return;
+  }
+
+  const float t = getLastTemperature();
+
+  HeaterEvent e;
+  e.tsSec           = getEpochOrUptimeSec();
+  e.tempCenti       = isnan(t) ? INT16_MIN : (int16_t)roundf(t * 100.0f);
+  e.setPointCenti   = (int16_t)roundf(getSetPoint() * 100.0f);
+  e.hysteresisCenti = (int16_t)roundf(getHysteresis() * 100.0f);
+  e.on              = on ? 1 : 0;
+  e.cause           = (uint8_t)cause;
+
+  phaseFile.seek(recOffset(phdr.head), SeekSet);
+  if (phaseFile.write((const uint8_t*)&e, sizeof(e)) != sizeof(e))
+  {
+    Serial.println(F("[PHASE] Write failed"));
+    return;
+  }
+
+  phdr.seq++;
+  phdr.head = (phdr.head + 1) % phdr.capacity;
+  if (phdr.count < phdr.capacity)
+  {
+    phdr.count++;
+  }
+  phaseFile.seek(0, SeekSet);
+  phaseFile.write((const uint8_t*)&phdr, sizeof(phdr));
+  phaseFile.flush();
+
+  Serial.printf("[PHASE] Heater %s (%s) at %lu\n", on ? "ON" : "OFF",
+                causeToStr(cause), (unsigned long)e.tsSec);
+}
+
+/***************** eventKey *****************************************************
+ * params: seq, keySeq
+ * return: uint32_t
+ * Description:
+ * Sort key for the binary search: epoch seconds. Edges logged before NTP
+ * sync carry uptime stamps and can sit anywhere in the ring (reboot); like
+ * raw history samples (see lowerBoundTs()) they take the key of the next
+ * epoch event, UINT32_MAX if there is none. That keeps the keys monotonic.
+ * keySeq returns the event the key was taken from, so the search can skip
+ * the whole uptime run.
+ ******************************************************************************/
+static uint32_t eventKey(uint32_t seq, uint32_t& keySeq)
+{
+  HistoryCursor c;
+  c.nextSeq = seq;
+  c.endSeq  = phdr.seq;
+  HeaterEvent buf[8];
+  size_t r;
+  while ((r = readPhaseCursor(c, buf, 8)) > 0)
+  {
+    for (size_t i = 0; i < r; i++)
+    {
+      if (buf[i].tsSec >= EPOCH_MIN)
+      {
+        keySeq = c.nextSeq - r + i;
+        return buf[i].tsSec;
+      }
+    }
+  }
+  keySeq = phdr.seq;
+  return UINT32_MAX;
+}
+
+/***************** lowerBound ***************************************************/
+static uint32_t lowerBound(uint32_t ts, uint32_t lo, uint32_t hi)
+{
+  while (lo != hi)
+  {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    uint32_t keySeq;
+    if (eventKey(mid, keySeq) < ts)
+    {
+      // Uptime-Lauf bis keySeq hat denselben Schlüssel: ganz überspringen
+      lo = ((int32_t)(hi - keySeq) > 1) ? keySeq + 1 : hi;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/***************** openPhaseRange ***********************************************/
+size_t openPhaseRange(HistoryCursor& c, uint32_t fromTs, uint32_t toTs)
+{
+  const uint32_t oldest = phdr.seq - phdr.count;
+  c.nextSeq = phdr.seq;
+  c.endSeq  = phdr.seq;
+  if (!phaseFile || phdr.count == 0 || toTs < fromTs)
+  {
+    return 0;
+  }
+
+  c.nextSeq = lowerBound(fromTs, oldest, phdr.seq);
+  c.endSeq  = (toTs == UINT32_MAX) ? phdr.seq : lowerBound(toTs + 1, c.nextSeq, phdr.seq);
+
+  // Fenster beginnt mitten in einer Phase -> zugehöriges EIN mitnehmen
+  HeaterEvent prev;
+  if (c.nextSeq != oldest && readEvent(c.nextSeq - 1, prev) && prev.on)
+  {
+    c.nextSeq--;
+  }
+  return c.endSeq - c.nextSeq;
+}
+
+/***************** readPhaseCursor **********************************************/
+size_t readPhaseCursor(HistoryCursor& c, HeaterEvent* buf, size_t maxCount)
+{
+  if (!phaseFile || buf == nullptr)
+  {
+    return 0;
+  }
+
+  const uint32_t oldest = phdr.seq - phdr.count;
+  if ((int32_t)(c.nextSeq - oldest) < 0)
+  {
+    c.nextSeq = oldest; // inzwischen überschrieben
+  }
+
+  size_t got = 0;
+  while (got < maxCount && (int32_t)(c.endSeq - c.nextSeq) > 0)
+  {
+    // zusammenhängend bis zum Ringende lesen
+    const uint32_t idx = slotOf(c.nextSeq);
+    uint32_t run = c.endSeq - c.nextSeq;
+    if (run > maxCount - got)        run = maxCount - got;
+    if (run > phdr.capacity - idx)   run = phdr.capacity - idx;
+
+    phaseFile.seek(recOffset(idx), SeekSet);
+    const size_t bytes = (size_t)run * sizeof(HeaterEvent);
+    if (phaseFile.read((uint8_t*)&buf[got], bytes) != bytes)
+    {
+      Serial.println(F("[PHASE] Read failed"));
+      break;
+    }
+    got       += run;
+    c.nextSeq += run;
+  }
+  return got;
+}
@@ -0,0 +1,82 @@
+#ifndef PHASES_H
+#define PHASES_H
+
+#include <Arduino.h>
+#include "control.h"
+#include "history.h"
+
+/***************** Configuration ************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * Heater edge log: 12 bytes per on/off transition. 1024 events ≈ 12 KB,
+ * a few months at typical switching rates.
+ ******************************************************************************/
+#ifndef PHASES_FILE_PATH
+#define PHASES_FILE_PATH "/phases.bin"
+#endif
+
+#ifndef PHASES_RECORDS
+#define PHASES_RECORDS 1024
+#endif
+
+/***************** HeaterEvent **************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * One heater transition, 12 bytes:
+ * - tsSec           : epoch seconds (uptime before NTP sync)
+ * - tempCenti       : temperature * 100 at the edge
+ * - setPointCenti   : active set point * 100
+ * - hysteresisCenti : active hysteresis * 100
+ * - on              : 1 = switched ON, 0 = switched OFF
+ * - cause           : HeaterCause
+ ******************************************************************************/
+struct HeaterEvent
+{
+  uint32_t tsSec;
+  int16_t  tempCenti;
+  int16_t  setPointCenti;
+  int16_t  hysteresisCenti;
+  uint8_t  on;
+  uint8_t  cause;
+};
+
+/***************** initPhaseLog *************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Opens/creates the event ring (LittleFS must be mounted, see initHistory()).
+ * Edges before this call are not logged.
+ ******************************************************************************/
+bool initPhaseLog();
+
+/***************** logHeaterEdge ************************************************
+ * params: on, cause
+ * return: void
+ * Description:
+ * Appends one transition with the current time, temperature and set point.
+ * Called by setHeater() only when the relay state actually changes.
+ ******************************************************************************/
+void logHeaterEdge(bool on, HeaterCause cause);
+
+/***************** openPhaseRange ***********************************************
+ * params: c, fromTs, toTs
+ * return: size_t
+ * Description:
+ * Opens a cursor over the events with fromTs <= ts <= toTs. If the window
+ * starts inside a phase, the ON event before fromTs is included so the
+ * phase can be paired. Pre-NTP (uptime) timestamps sort with the next
+ * epoch-stamped event.
+ ******************************************************************************/
+size_t openPhaseRange(HistoryCursor& c, uint32_t fromTs, uint32_t toTs);
+
+/***************** readPhaseCursor **********************************************
+ * params: c, buf, maxCount
+ * return: size_t
+ * Description:
+ * Reads the next chunk of events (oldest first). Returns 0 at the end.
+ ******************************************************************************/
+size_t readPhaseCursor(HistoryCursor& c, HeaterEvent* buf, size_t maxCount);
+
+#endif
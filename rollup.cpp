@@ -0,0 +1,442 @@
+#include "rollup.h"
+#include "history.h"
+#include "config.h"
+#include "ntp.h"
+#include <LittleFS.h>
+#include <time.h>
+
+struct RollupHeader
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recSize;
+  uint32_t capacity;   // Anzahl Records
+  uint32_t head;       // nächste Schreibposition (0..capacity-1)
+  uint32_t count;      // gültige Anzahl
+  uint32_t seq;        // laufende Nummer des nächsten Records
+};
+
+/***************** RollupRing ***************************************************
+ * Description:
+ * One rollup tier: ring file plus the bucket currently being accumulated.
+ ******************************************************************************/
+struct RollupRing
+{
+  const char*  path;
+  uint32_t     capacity;
+  uint32_t     bucketSec;
+  File         file;
+  RollupHeader hdr;
+  uint32_t     lastTs;    // Start des zuletzt gespeicherten Buckets (0 = keiner)
+
+  // laufender Bucket
+  uint32_t     bucket;
+  uint32_t     n;
+  int32_t      sumT;
+  int32_t      sumSp;
+  int32_t      sumHy;
+  int16_t      minT;
+  int16_t      maxT;
+  uint32_t     onCount;
+};
+
+static const uint32_t ROLLUP_MAGIC    = 0x48524F4CUL; // "HROL"
+static const uint16_t ROLLUP_VERSION  = 1;
+static const uint32_t EPOCH_MIN       = 1609459200UL; // wie validEpoch() in ntp.cpp
+
+static RollupRing rings[2] =
+{
+  { HISTORY_HOURLY_PATH, HISTORY_HOURLY_RECORDS, 3600UL,  File(), {}, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+  { HISTORY_DAILY_PATH,  HISTORY_DAILY_RECORDS,  86400UL, File(), {}, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+};
+
+static inline RollupRing& ringFor(HistoryTier tier)
+{
+  return rings[(tier == TIER_DAILY) ? 1 : 0];
+}
+
+static inline size_t recOffset(const RollupRing& r, uint32_t idx)
+{
+  return sizeof(RollupHeader) + (size_t)idx * sizeof(RollupSample);
+}
+
+static inline uint32_t slotOf(const RollupRing& r, uint32_t seq)
+{
+  return (r.hdr.head + r.capacity - (r.hdr.seq - seq)) % r.capacity;
+}
+
+/***************** bucketStart **************************************************
+ * params: r, ts
+ * return: uint32_t
+ * Description:
+ * Hourly buckets start on the full hour, daily buckets at local midnight
+ * (TZ from initNtp(), so DST days have 23/25 hours).
+ ******************************************************************************/
+static uint32_t bucketStart(const RollupRing& r, uint32_t ts)
+{
+  if (r.bucketSec != 86400UL)
+  {
+    return ts - (ts % r.bucketSec);
+  }
+  const time_t t = (time_t)ts;
+  struct tm lt;
+  localtime_r(&t, &lt);
+  // über mktime(), nicht ts - Uhrzeit: nach der Umstellung wäre das 1 h daneben
+  lt.tm_hour  = 0;
+  lt.tm_min   = 0;
+  lt.tm_sec   = 0;
+  lt.tm_isdst = -1;
+  return (uint32_t)mktime(&lt);
+}
+
+/***************** readRecord ***************************************************/
+static bool readRecord(RollupRing& r, uint32_t seq, RollupSample& out)
+{
+  r.file.seek(recOffset(r, slotOf(r, seq)), SeekSet);
+  return r.file.read((uint8_t*)&out, sizeof(out)) == sizeof(out);
+}
+
+/***************** openRing *****************************************************
+ * params: r
+ * return: bool
+ * Description:
+ * Resumes a rollup ring if its header validates, otherwise creates it.
+ ******************************************************************************/
+static bool openRing(RollupRing& r)
+{
+  const size_t total = sizeof(RollupHeader) + (size_t)r.capacity * sizeof(RollupSample);
+
+  if (LittleFS.exists(r.path))
+  {
+    r.file = LittleFS.open(r.path, "r+");
+    if (r.file)
+    {
+      RollupHeader h;
+      r.file.seek(0, SeekSet);
+      const bool ok = r.file.read((uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+                      h.magic == ROLLUP_MAGIC && h.version == ROLLUP_VERSION &&
+                      h.recSize == sizeof(RollupSample) && h.capacity == r.capacity &&
+                      h.head < h.capacity && h.count <= h.capacity && h.seq >= h.count &&
+                      r.file.size() >= total;
+      if (ok)
+      {
+        r.hdr = h;
+        r.lastTs = 0;
+        RollupSample last;
+        if (r.hdr.count > 0 && readRecord(r, r.hdr.seq - 1, last))
+        {
+          r.lastTs = last.tsSec;
+        }
+        Serial.printf("[HIST] Rollup %s resumed count=%lu\n", r.path, (unsigned long)r.hdr.count);
+        return true;
+      }
+      r.file.close();
+    }
+    LittleFS.remove(r.path);
+  }
+
+  r.file = LittleFS.open(r.path, "w+");
+  if (!r.file)
+  {
+    Serial.printf("[HIST] Rollup %s create failed\n", r.path);
+    return false;
+  }
+
+  r.hdr.magic    = ROLLUP_MAGIC;
+  r.hdr.version  = ROLLUP_VERSION;
+  r.hdr.recSize  = sizeof(RollupSample);
+  r.hdr.capacity = r.capacity;
+  r.hdr.head     = 0;
+  r.hdr.count    = 0;
+  r.hdr.seq      = 0;
+  r.lastTs       = 0;
+
+  r.file.seek(0, SeekSet);
+  r.file.write((const uint8_t*)&r.hdr, sizeof(r.hdr));
+  r.file.seek(total - 1, SeekSet);
+  r.file.write((const uint8_t*)"\0", 1);
+  r.file.flush();
+
+  Serial.printf("[HIST] Rollup %s created capacity=%lu\n", r.path, (unsigned long)r.capacity);
+  return true;
+}
+
+/***************** emitBucket ***************************************************
+ * params: r
+ * return: void
+ * Description:
+ * Writes the running bucket (one record + header, once per hour/day).
+ * Buckets not newer than the last stored one are dropped (replay guard).
+ ******************************************************************************/
+static void emitBucket(RollupRing& r)
+{
+  if (r.n == 0 || !r.file || (r.lastTs != 0 && r.bucket <= r.lastTs))
+  {
+    return;
+  }
+
+  RollupSample s;
+  s.tsSec      = r.bucket;
+  s.tMinCenti  = r.minT;
+  s.tMaxCenti  = r.maxT;
+  s.tAvgCenti  = (int16_t)(r.sumT / (int32_t)r.n);
+  s.spAvgCenti = (int16_t)(r.sumSp / (int32_t)r.n);
+  s.hyAvgCenti = (int16_t)(r.sumHy / (int32_t)r.n);
+  s.dutyPct    = (uint8_t)((r.onCount * 100UL + r.n / 2) / r.n);
+  s.samples    = (uint8_t)min(r.n, (uint32_t)255);
+
+  r.file.seek(recOffset(r, r.hdr.head), SeekSet);
+  if (r.file.write((const uint8_t*)&s, sizeof(s)) != sizeof(s))
+  {
+    Serial.println(F("[HIST] Rollup write failed"));
+    return;
+  }
+
+  r.hdr.seq++;
+  r.hdr.head = (r.hdr.head + 1) % r.capacity;
+  if (r.hdr.count < r.capacity)
+  {
+    r.hdr.count++;
+  }
+  r.file.seek(0, SeekSet);
+  r.file.write((const uint8_t*)&r.hdr, sizeof(r.hdr));
+  r.file.flush();
+  r.lastTs = s.tsSec;
+}
+
+/***************** accumulate ***************************************************/
+static void accumulate(RollupRing& r, const LogSample& s)
+{
+  const uint32_t b = bucketStart(r, s.tsSec);
+  if (r.n > 0 && b != r.bucket)
+  {
+    emitBucket(r);
+    r.n = 0;
+  }
+
+  if (r.n == 0)
+  {
+    r.bucket  = b;
+    r.sumT    = 0;
+    r.sumSp   = 0;
+    r.sumHy   = 0;
+    r.minT    = s.tempCenti;
+    r.maxT    = s.tempCenti;
+    r.onCount = 0;
+  }
+
+  r.n++;
+  r.sumT  += s.tempCenti;
+  r.sumSp += s.setPointCenti;
+  r.sumHy += s.hysteresisCenti;
+  if (s.tempCenti < r.minT) r.minT = s.tempCenti;
+  if (s.tempCenti > r.maxT) r.maxT = s.tempCenti;
+  if (s.flags & 0x01)
+  {
+    r.onCount++;
+  }
+}
+
+/***************** addRollupSample **********************************************/
+void addRollupSample(const LogSample& s)
+{
+  if (s.tsSec < EPOCH_MIN)
+  {
+    return; // Uptime-Zeitstempel lassen sich keinem Bucket zuordnen
+  }
+  for (RollupRing& r : rings)
+  {
+    accumulate(r, s);
+  }
+}
+
+/***************** initRollups **************************************************/
+bool initRollups()
+{
+  bool ok = true;
+  for (RollupRing& r : rings)
+  {
+    ok = openRing(r) && ok;
+    r.n = 0;
+  }
+
+  // Raw-Samples ab dem ältesten fehlenden Bucket nachspielen. Dessen Start
+  // über bucketStart(): ein Tag nach DST-Umstellung hat 23/25 h, eine halbe
+  // Bucket-Länge Zuschlag landet sicher im Folge-Bucket.
+  uint32_t replayFrom = UINT32_MAX;
+  for (RollupRing& r : rings)
+  {
+    const uint32_t from = (r.lastTs == 0) ? 0 : bucketStart(r, r.lastTs + r.bucketSec + r.bucketSec / 2);
+    if (from < replayFrom)
+    {
+      replayFrom = from;
+    }
+  }
+
+  const unsigned long t0 = millis();
+  HistoryCursor c;
+  const size_t n = openHistoryRange(c, replayFrom, UINT32_MAX);
+  LogSample buf[16];
+  size_t got;
+  while ((got = readHistoryCursor(c, buf, 16)) > 0)
+  {
+    for (size_t i = 0; i < got; i++)
+    {
+      addRollupSample(buf[i]);
+    }
+    yield();
+  }
+
+  Serial.printf("[HIST] Rollups replayed %u raw samples in %lu ms\n", (unsigned)n, millis() - t0);
+  return ok;
+}
+
+/***************** tierBucketSec ************************************************/
+uint32_t tierBucketSec(HistoryTier tier)
+{
+  if (tier == TIER_RAW)
+  {
+    return (uint32_t)LOG_INTERVAL_MINUTES * 60UL;
+  }
+  return ringFor(tier).bucketSec;
+}
+
+/***************** tierOldestTs *************************************************/
+static uint32_t tierOldestTs(HistoryTier tier)
+{
+  if (tier == TIER_RAW)
+  {
+    return getHistoryOldestTs();
+  }
+  RollupRing& r = ringFor(tier);
+  RollupSample s;
+  if (!r.file || r.hdr.count == 0 || !readRecord(r, r.hdr.seq - r.hdr.count, s))
+  {
+    return UINT32_MAX;
+  }
+  return s.tsSec;
+}
+
+/***************** pickHistoryTier **********************************************/
+HistoryTier pickHistoryTier(uint32_t fromTs, uint32_t toTs, size_t maxPoints)
+{
+  if (toTs == UINT32_MAX)
+  {
+    toTs = getEpochOrUptimeSec();
+  }
+  const uint32_t span = (toTs > fromTs) ? toTs - fromTs : 0;
+
+  uint32_t oldest[3];
+  for (int t = TIER_RAW; t <= TIER_DAILY; t++)
+  {
+    oldest[t] = tierOldestTs((HistoryTier)t);
+  }
+
+  for (int t = TIER_RAW; t < TIER_DAILY; t++)
+  {
+    const HistoryTier tier = (HistoryTier)t;
+    const uint32_t step = tierBucketSec(tier);
+    if (step == 0)
+    {
+      continue;
+    }
+    // Ein Tier deckt das Fenster ab, wenn es weit genug zurückreicht oder
+    // kein gröberes Tier weiter zurückreicht (junges Gerät, Rollups noch leer).
+    uint32_t coarserOldest = UINT32_MAX;
+    for (int c = t + 1; c <= TIER_DAILY; c++)
+    {
+      coarserOldest = min(coarserOldest, oldest[c]);
+    }
+    const bool covers = oldest[t] <= fromTs + step || oldest[t] <= coarserOldest;
+    if (covers && span / step <= maxPoints)
+    {
+      return tier;
+    }
+  }
+
+  // Zu viele Punkte für alle feineren Tiers: gröbstes Tier mit Daten
+  for (int t = TIER_DAILY; t > TIER_RAW; t--)
+  {
+    if (oldest[t] != UINT32_MAX)
+    {
+      return (HistoryTier)t;
+    }
+  }
+  return TIER_RAW;
+}
+
+/***************** openRollupRange **********************************************/
+size_t openRollupRange(HistoryTier tier, HistoryCursor& c, uint32_t fromTs, uint32_t toTs)
+{
+  RollupRing& r = ringFor(tier);
+  c.nextSeq = r.hdr.seq;
+  c.endSeq  = r.hdr.seq;
+  if (!r.file || r.hdr.count == 0 || toTs < fromTs)
+  {
+    return 0;
+  }
+
+  // Bucket-Starts sind monoton -> zwei einfache Binärsuchen
+  uint32_t bounds[2] = { fromTs, toTs };
+  uint32_t result[2];
+  for (int k = 0; k < 2; k++)
+  {
+    uint32_t lo = (k == 0) ? r.hdr.seq - r.hdr.count : result[0];
+    uint32_t hi = r.hdr.seq;
+    while (lo != hi)
+    {
+      const uint32_t mid = lo + (hi - lo) / 2;
+      RollupSample s;
+      const bool before = readRecord(r, mid, s) &&
+                          ((k == 0) ? (s.tsSec < bounds[k]) : (s.tsSec <= bounds[k]));
+      if (before)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    result[k] = lo;
+  }
+
+  c.nextSeq = result[0];
+  c.endSeq  = result[1];
+  return c.endSeq - c.nextSeq;
+}
+
+/***************** readRollupCursor *********************************************/
+size_t readRollupCursor(HistoryTier tier, HistoryCursor& c, RollupSample* buf, size_t maxCount)
+{
+  RollupRing& r = ringFor(tier);
+  if (!r.file || buf == nullptr)
+  {
+    return 0;
+  }
+
+  const uint32_t oldest = r.hdr.seq - r.hdr.count;
+  if ((int32_t)(c.nextSeq - oldest) < 0)
+  {
+    c.nextSeq = oldest;
+  }
+
+  size_t got = 0;
+  while (got < maxCount && (int32_t)(c.endSeq - c.nextSeq) > 0)
+  {
+    // zusammenhängender Lauf bis Ring-Ende, Cursor-Ende oder Puffer voll
+    const uint32_t idx = slotOf(r, c.nextSeq);
+    uint32_t run = min((uint32_t)(maxCount - got), c.endSeq - c.nextSeq);
+    run = min(run, r.capacity - idx);
+
+    r.file.seek(recOffset(r, idx), SeekSet);
+    const size_t bytes = (size_t)run * sizeof(RollupSample);
+    if (r.file.read((uint8_t*)&buf[got], bytes) != bytes)
+    {
+      break;
+    }
+    got       += run;
+    c.nextSeq += run;
+  }
+  return got;
+}
@@ -0,0 +1,129 @@
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <Arduino.h>
+#include "history.h"
+
+/***************** Configuration ************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * Rollup rings live next to the raw ring. 16 bytes per record:
+ * 2160 hourly (90 days) ≈ 34 KB, 730 daily (2 years) ≈ 12 KB.
+ ******************************************************************************/
+#ifndef HISTORY_HOURLY_PATH
+#define HISTORY_HOURLY_PATH "/hist_h.bin"
+#endif
+
+#ifndef HISTORY_DAILY_PATH
+#define HISTORY_DAILY_PATH "/hist_d.bin"
+#endif
+
+#ifndef HISTORY_HOURLY_RECORDS
+#define HISTORY_HOURLY_RECORDS 2160
+#endif
+
+#ifndef HISTORY_DAILY_RECORDS
+#define HISTORY_DAILY_RECORDS 730
+#endif
+
+// Chart width in points; tier selection keeps a window below this.
+#ifndef HISTORY_MAX_POINTS
+#define HISTORY_MAX_POINTS 600
+#endif
+
+/***************** HistoryTier **************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Resolution tiers, finest first.
+ ******************************************************************************/
+enum HistoryTier
+{
+  TIER_RAW = 0,
+  TIER_HOURLY,
+  TIER_DAILY
+};
+
+/***************** RollupSample *************************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * One aggregated bucket, 16 bytes:
+ * - tsSec       : bucket start (full hour / local midnight, epoch seconds)
+ * - tMinCenti   : minimum temperature * 100
+ * - tMaxCenti   : maximum temperature * 100
+ * - tAvgCenti   : mean temperature * 100
+ * - spAvgCenti  : mean set point * 100
+ * - hyAvgCenti  : mean hysteresis * 100
+ * - dutyPct     : share of samples with heater ON (0..100)
+ * - samples     : raw samples aggregated (saturates at 255)
+ ******************************************************************************/
+struct RollupSample
+{
+  uint32_t tsSec;
+  int16_t  tMinCenti;
+  int16_t  tMaxCenti;
+  int16_t  tAvgCenti;
+  int16_t  spAvgCenti;
+  int16_t  hyAvgCenti;
+  uint8_t  dutyPct;
+  uint8_t  samples;
+};
+
+/***************** initRollups **************************************************
+ * params: none
+ * return: bool
+ * Description:
+ * Opens/creates the hourly and daily rings (LittleFS must be mounted) and
+ * replays raw samples newer than the last stored bucket, so buckets missed
+ * across a reboot are filled in and the current buckets are pre-seeded.
+ ******************************************************************************/
+bool initRollups();
+
+/***************** addRollupSample **********************************************
+ * params: s
+ * return: void
+ * Description:
+ * Feeds one raw sample into the running hourly/daily buckets. A bucket is
+ * written when the first sample of the next bucket arrives. Samples without
+ * an epoch timestamp are ignored.
+ ******************************************************************************/
+void addRollupSample(const LogSample& s);
+
+/***************** pickHistoryTier **********************************************
+ * params: fromTs, toTs, maxPoints
+ * return: HistoryTier
+ * Description:
+ * Picks the finest tier that needs at most maxPoints points for the window
+ * and reaches back to fromTs (or at least as far as any coarser tier).
+ * Falls back to the coarsest tier holding data.
+ ******************************************************************************/
+HistoryTier pickHistoryTier(uint32_t fromTs, uint32_t toTs, size_t maxPoints);
+
+/***************** openRollupRange **********************************************
+ * params: tier, c, fromTs, toTs
+ * return: size_t
+ * Description:
+ * Opens a cursor over the buckets of a rollup tier with fromTs <= ts <= toTs
+ * (bucket start times are monotonic, plain binary search).
+ ******************************************************************************/
+size_t openRollupRange(HistoryTier tier, HistoryCursor& c, uint32_t fromTs, uint32_t toTs);
+
+/***************** readRollupCursor *********************************************
+ * params: tier, c, buf, maxCount
+ * return: size_t
+ * Description:
+ * Reads the next chunk of buckets (oldest first). Returns 0 at the end.
+ ******************************************************************************/
+size_t readRollupCursor(HistoryTier tier, HistoryCursor& c, RollupSample* buf, size_t maxCount);
+
+/***************** tierBucketSec ************************************************
+ * params: tier
+ * return: uint32_t
+ * Description:
+ * Nominal spacing of a tier in seconds.
+ ******************************************************************************/
+uint32_t tierBucketSec(HistoryTier tier);
+
+#endif
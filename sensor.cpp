@@ -8,6 +8,7 @@ static Adafruit_Si7021 sensor = Adafruit_Si7021();
 static float lastTemp = NAN;
 static float lastHumidity = NAN;
 static unsigned long lastRead = 0;
+static uint32_t readCount = 0;
 
 /***************** initSensor **************************************************/
 bool initSensor()
@@ -35,6 +36,7 @@ void handleSensor()
   lastRead = now;
   lastTemp = sensor.readTemperature();
   lastHumidity = sensor.readHumidity();
+  readCount++;
 
   Serial.printf("[SENSOR] T=%.2f°C | RH=%.2f%%\n", lastTemp, lastHumidity);
 }
@@ -50,3 +52,9 @@ float getLastHumidity()
 {
   return lastHumidity;
 }
+
+/***************** getSensorReadCount *******************************************/
+uint32_t getSensorReadCount()
+{
+  return readCount;
+}
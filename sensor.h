@@ -1,6 +1,8 @@
 #ifndef SENSOR_H
 #define SENSOR_H
 
+#include <Arduino.h>
+
 /***************** initSensor ***************************************************
  * Initializes the GY-21 (Si7021) sensor via I2C and validates communication.
  ******************************************************************************/
@@ -16,5 +18,6 @@ void handleSensor();
  ******************************************************************************/
 float getLastTemperature();
 float getLastHumidity();
+uint32_t getSensorReadCount();   // zählt jede Messung (auch NaN), für Aggregate
 
 #endif
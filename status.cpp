@@ -0,0 +1,89 @@
+#include "status.h"
+#include "config.h"
+#include "control.h"
+#include "sensor.h"
+#include "mqtt.h"
+#include "ntp.h"
+#include <string.h>
+
+static StatusSnapshot current;
+static uint32_t       version = 0;   // 0 = noch nie erfasst
+static uint32_t       bootId  = 0;
+
+/***************** captureStatus ************************************************
+ * params: s
+ * return: void
+ * Description:
+ * Fills a snapshot from the subsystem getters.
+ ******************************************************************************/
+static void captureStatus(StatusSnapshot& s)
+{
+  memset(&s, 0, sizeof(s));   // Padding mitvergleichen (memcmp)
+
+  const float t = getLastTemperature();
+  const float h = getLastHumidity();
+  s.tempDeci = isnan(t) ? INT16_MIN : (int16_t)lroundf(t * 10.0f);
+  s.humPct   = isnan(h) ? -1 : (int8_t)(h < 0.0f ? 0 : h > 100.0f ? 100 : lroundf(h));
+
+  s.heater       = isHeaterOn();
+  s.mode         = (uint8_t)getControlMode();
+  s.state        = (uint8_t)getControlState();
+  s.setPointDeci = (int16_t)lroundf(getSetPoint() * 10.0f);
+
+  if (getControlMode() == MODE_BOOST)
+  {
+    const long left = (long)(getBoostEndTime() - millis());
+    s.boostMin = left > 0 ? (uint16_t)((left + 59999L) / 60000L) : 0;
+  }
+
+  s.mqtt     = mqttIsConnected();
+  s.timeSync = isTimeSynced();
+}
+
+/***************** handleStatus *************************************************/
+void handleStatus()
+{
+  StatusSnapshot next;
+  captureStatus(next);
+
+  if (version == 0)
+  {
+    bootId = ESP.random() & 0xFFFFFF;
+  }
+  else if (memcmp(&next, &current, sizeof(next)) == 0)
+  {
+    return;
+  }
+
+  current = next;
+  version++;
+}
+
+/***************** getStatus ****************************************************/
+const StatusSnapshot& getStatus()
+{
+  if (version == 0)
+  {
+    handleStatus();
+  }
+  return current;
+}
+
+/***************** getStatusVersion *********************************************/
+uint32_t getStatusVersion()
+{
+  if (version == 0)
+  {
+    handleStatus();
+  }
+  return version;
+}
+
+/***************** getStatusEtag ************************************************/
+String getStatusEtag()
+{
+  const uint32_t v = getStatusVersion();   // erfasst ggf. erst (setzt bootId)
+  char buf[24];
+  snprintf(buf, sizeof(buf), "\"%06lx-%lu\"", (unsigned long)bootId, (unsigned long)v);
+  return String(buf);
+}
@@ -0,0 +1,65 @@
+#ifndef STATUS_H
+#define STATUS_H
+
+#include <Arduino.h>
+
+/***************** StatusSnapshot ***********************************************
+ * params: n/a
+ * return: n/a
+ * Description:
+ * Live state as shown to clients, quantised to what the UI displays so that
+ * sensor noise below the display resolution does not count as a change.
+ * - tempDeci     : temperature * 10, INT16_MIN = no reading
+ * - humPct       : relative humidity in %, -1 = no reading
+ * - setPointDeci : effective set point * 10 (day/night/boost resolved)
+ * - boostMin     : remaining boost minutes (rounded up), 0 outside BOOST
+ ******************************************************************************/
+struct StatusSnapshot
+{
+  int16_t  tempDeci;
+  int8_t   humPct;
+  bool     heater;
+  uint8_t  mode;          // ControlMode
+  uint8_t  state;         // ControlState
+  int16_t  setPointDeci;
+  uint16_t boostMin;
+  bool     mqtt;
+  bool     timeSync;
+};
+
+/***************** handleStatus *************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Re-captures the snapshot and bumps the state version if any field changed.
+ * Cheap (a handful of getters and a compare); call from loop() and before
+ * answering a status request.
+ ******************************************************************************/
+void handleStatus();
+
+/***************** getStatus ****************************************************
+ * params: none
+ * return: const StatusSnapshot&
+ * Description:
+ * Snapshot as of the last handleStatus().
+ ******************************************************************************/
+const StatusSnapshot& getStatus();
+
+/***************** getStatusVersion *********************************************
+ * params: none
+ * return: uint32_t
+ * Description:
+ * Incremented on every snapshot change, starts at 1.
+ ******************************************************************************/
+uint32_t getStatusVersion();
+
+/***************** getStatusEtag ************************************************
+ * params: none
+ * return: String
+ * Description:
+ * Strong ETag for the current version, e.g. "\"3fa2c1-17\"". Contains a
+ * per-boot id so that a reboot never revalidates an old cached snapshot.
+ ******************************************************************************/
+String getStatusEtag();
+
+#endif // STATUS_H
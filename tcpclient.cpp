@@ -0,0 +1,220 @@
+#include <Arduino.h>
+#include "tcpclient.h"
+
+TcpClient::~TcpClient()
+{
+  stop();
+}
+
+/***************** connect ******************************************************
+ * params: ip, port
+ * return: int (1 = Verbindungsaufbau gestartet, 0 = Fehler)
+ * Description:
+ * Closes the previous socket and starts tcp_connect(). Returns at once; the
+ * connected callback or the error callback ends the connecting() state.
+ ******************************************************************************/
+int TcpClient::connect(IPAddress ip, uint16_t port)
+{
+  stop();
+  pcb = tcp_new();
+  if (!pcb)
+  {
+    return 0;
+  }
+  tcp_arg(pcb, this);
+  tcp_recv(pcb, onRecv);
+  tcp_err(pcb, onError);
+  state = TCPC_CONNECTING;
+  if (tcp_connect(pcb, ip, port, onConnected) != ERR_OK)
+  {
+    stop();
+    return 0;
+  }
+  return 1;
+}
+
+err_t TcpClient::onConnected(void* arg, tcp_pcb* tpcb, err_t err)
+{
+  static_cast<TcpClient*>(arg)->state = TCPC_CONNECTED;
+  return ERR_OK;
+}
+
+err_t TcpClient::onRecv(void* arg, tcp_pcb* tpcb, pbuf* p, err_t err)
+{
+  TcpClient* c = static_cast<TcpClient*>(arg);
+  if (!p)
+  {
+    c->state = TCPC_CLOSED;   // FIN vom Peer, Rest bleibt lesbar
+    return ERR_OK;
+  }
+  if (err != ERR_OK)
+  {
+    pbuf_free(p);
+    return ERR_OK;
+  }
+  if (c->rx)
+  {
+    pbuf_cat(c->rx, p);
+  }
+  else
+  {
+    c->rx    = p;
+    c->rxOff = 0;
+  }
+  return ERR_OK;
+}
+
+void TcpClient::onError(void* arg, err_t err)
+{
+  // lwIP hat den pcb bereits freigegeben (RST, Timeout, abgelehnt)
+  TcpClient* c = static_cast<TcpClient*>(arg);
+  c->pcb   = nullptr;
+  c->state = TCPC_CLOSED;
+}
+
+/***************** write ********************************************************
+ * params: buf, n
+ * return: size_t (queued bytes)
+ * Description:
+ * Queues as much as the lwIP send buffer takes and pushes it out. Never
+ * waits for ACKs; a short count means the socket is down or full.
+ ******************************************************************************/
+size_t TcpClient::write(const uint8_t* buf, size_t n)
+{
+  if (!pcb || state != TCPC_CONNECTED)
+  {
+    return 0;
+  }
+  const size_t room = tcp_sndbuf(pcb);
+  if (n > room)
+  {
+    n = room;
+  }
+  if (n == 0 || tcp_write(pcb, buf, n, TCP_WRITE_FLAG_COPY) != ERR_OK)
+  {
+    return 0;
+  }
+  tcp_output(pcb);
+  return n;
+}
+
+int TcpClient::available()
+{
+  return rx ? (int)(rx->tot_len - rxOff) : 0;
+}
+
+int TcpClient::read()
+{
+  uint8_t b;
+  return (read(&b, 1) == 1) ? b : -1;
+}
+
+int TcpClient::read(uint8_t* buf, size_t n)
+{
+  size_t k = 0;
+  while (k < n && rx)
+  {
+    size_t chunk = rx->len - rxOff;
+    if (chunk > n - k)
+    {
+      chunk = n - k;
+    }
+    memcpy(buf + k, (const uint8_t*)rx->payload + rxOff, chunk);
+    k += chunk;
+    consume(chunk);
+  }
+  return (int)k;
+}
+
+int TcpClient::peek()
+{
+  return rx ? ((const uint8_t*)rx->payload)[rxOff] : -1;
+}
+
+size_t TcpClient::peekBytes(uint8_t* buf, size_t n)
+{
+  if (!rx)
+  {
+    return 0;
+  }
+  const size_t avail = (size_t)available();
+  return pbuf_copy_partial(rx, buf, (n < avail) ? n : avail, rxOff);
+}
+
+void TcpClient::flush()
+{
+  if (pcb && state == TCPC_CONNECTED)
+  {
+    tcp_output(pcb);
+  }
+}
+
+/***************** stop *********************************************************
+ * params: none
+ * return: void
+ * Description:
+ * Detaches the callbacks and closes the socket (abort if lwIP cannot queue
+ * the FIN). Unread data is dropped.
+ ******************************************************************************/
+void TcpClient::stop()
+{
+  if (pcb)
+  {
+    tcp_arg(pcb, nullptr);
+    tcp_recv(pcb, nullptr);
+    tcp_err(pcb, nullptr);
+    if (tcp_close(pcb) != ERR_OK)
+    {
+      tcp_abort(pcb);
+    }
+    pcb = nullptr;
+  }
+  dropRx();
+  state = TCPC_CLOSED;
+}
+
+uint8_t TcpClient::connected()
+{
+  // wie WiFiClient: nach FIN verbunden, solange noch Daten zu lesen sind
+  return state == TCPC_CONNECTED || available() > 0;
+}
+
+/***************** consume ******************************************************
+ * params: n
+ * return: void
+ * Description:
+ * Marks n bytes of the first pbuf as read, frees it once empty and opens
+ * the receive window by the same amount.
+ ******************************************************************************/
+void TcpClient::consume(size_t n)
+{
+  if (rx->len - rxOff > n)
+  {
+    rxOff += n;
+  }
+  else
+  {
+    pbuf* head = rx;
+    rx    = head->next;
+    rxOff = 0;
+    if (rx)
+    {
+      pbuf_ref(rx);
+    }
+    pbuf_free(head);
+  }
+  if (pcb)
+  {
+    tcp_recved(pcb, n);
+  }
+}
+
+void TcpClient::dropRx()
+{
+  if (rx)
+  {
+    pbuf_free(rx);
+    rx = nullptr;
+  }
+  rxOff = 0;
+}
@@ -0,0 +1,60 @@
+#ifndef TCPCLIENT_H
+#define TCPCLIENT_H
+
+#include <Arduino.h>
+#include <Client.h>
+#include <IPAddress.h>
+#include <lwip/tcp.h>
+
+/***************** TcpClient ****************************************************
+ * Description:
+ * Small Client on the raw lwIP TCP API whose connect() does not wait:
+ * tcp_connect() is started and the result arrives in a callback. Poll
+ * connecting()/connected() until the socket is up or has failed; the
+ * caller owns the timeout. Received pbufs are kept in a chain and handed
+ * out without copying into a second buffer.
+ *
+ * write() never waits either: it queues what fits into the send buffer and
+ * returns the count (short count = failure for PubSubClient). Everything
+ * runs in loop() context, lwIP callbacks never interrupt a method.
+ * connect(host, port) is not supported (resolve first, see mqtt.cpp).
+ ******************************************************************************/
+class TcpClient : public Client
+{
+public:
+  TcpClient() {}
+  ~TcpClient();
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override { return 0; }
+  bool connecting() const { return state == TCPC_CONNECTING; }
+
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t* buf, size_t n) override;
+  int available() override;
+  int read() override;
+  int read(uint8_t* buf, size_t n) override;
+  int peek() override;
+  size_t peekBytes(uint8_t* buf, size_t n);
+  void flush() override;
+  void stop() override;
+  uint8_t connected() override;
+  operator bool() override { return pcb != nullptr; }
+
+private:
+  enum State : uint8_t { TCPC_CLOSED, TCPC_CONNECTING, TCPC_CONNECTED };
+
+  static err_t onConnected(void* arg, tcp_pcb* tpcb, err_t err);
+  static err_t onRecv(void* arg, tcp_pcb* tpcb, pbuf* p, err_t err);
+  static void  onError(void* arg, err_t err);
+
+  void consume(size_t n);
+  void dropRx();
+
+  tcp_pcb* pcb   = nullptr;
+  pbuf*    rx    = nullptr;   // empfangene Daten, Kette
+  size_t   rxOff = 0;         // bereits gelesen im ersten pbuf
+  State    state = TCPC_CLOSED;
+};
+
+#endif
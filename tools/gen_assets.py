@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""Compress web/app.css and web/app.js into assets_gz.h (PROGMEM).
+
+Run after editing anything below web/:
+
+    python3 tools/gen_assets.py
+
+The output is deterministic (gzip mtime 0), so an unchanged asset keeps its
+ETag and browsers keep using their cached copy across firmware updates.
+"""
+
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+ASSETS = [
+    # (source, symbol prefix, content type)
+    ("web/app.css", "APP_CSS", "text/css"),
+    ("web/app.js", "APP_JS", "application/javascript"),
+]
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = [
+        "// Generated by tools/gen_assets.py from web/ - do not edit.",
+        "#ifndef ASSETS_GZ_H",
+        "#define ASSETS_GZ_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+
+    for src, sym, ctype in ASSETS:
+        with open(os.path.join(ROOT, src), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(gz).hexdigest()[:16]
+
+        out += [
+            "// %s: %d bytes, gzip %d bytes" % (src, len(raw), len(gz)),
+            "#define %s_TYPE \"%s\"" % (sym, ctype),
+            "#define %s_ETAG \"\\\"%s\\\"\"" % (sym, etag),
+            "#define %s_VER  \"%s\"" % (sym, etag[:8]),
+            "static const size_t  %s_GZ_LEN = %d;" % (sym, len(gz)),
+            "static const uint8_t %s_GZ[] PROGMEM = {" % sym,
+            c_array(gz),
+            "};",
+            "",
+        ]
+        print("%-12s %6d -> %6d bytes (etag %s)" % (src, len(raw), len(gz), etag))
+
+    out += ["#endif", ""]
+    with open(os.path.join(ROOT, "assets_gz.h"), "w", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
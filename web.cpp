@@ -1,5 +1,5 @@
 #include "web.h"
-#include <ESP8266WebServer.h>
+#include "httpd.h"
 #include <ESP8266WiFi.h>
 #include "config.h"
 #include "control.h"
@@ -7,10 +7,19 @@
 #include "mqtt.h"
 #include "ntp.h"
 #include "history.h"
+#include "rollup.h"
+#include "phases.h"
+#include "lttb.h"
+#include "status.h"
+#include "metrics.h"
+#include "assets_gz.h"
+#include <ArduinoJson.h>
 #include <stdlib.h>
+#include <time.h>
+#include <new>
 
-/***************** Module Globals **********************************************/
-ESP8266WebServer webServer(80);
+// Event-Streams dürfen nie alle HTTP-Slots belegen
+static_assert(EVENTS_MAX_CLIENTS < HTTPD_MAX_CLIENTS, "EVENTS_MAX_CLIENTS must leave an HTTP slot for normal requests");
 
 static float clampFloat(float v, float lo, float hi)
 {
@@ -62,39 +71,42 @@ static int parseTimeMinutes(const String &val)
 }
 
 /***************** redirectToRoot *********************************************
- * params: none
+ * params: c
  * return: void
  * Description:
  * Uses PRG pattern: after POST actions redirect back to "/".
  ******************************************************************************/
-static void redirectToRoot()
+static void redirectToRoot(HttpConn& c)
 {
-  webServer.sendHeader("Location", "/", true);
-  webServer.send(303, "text/plain", "");
+  httpAddHeader(c, "Location", "/");
+  httpSend(c, 303, "text/plain", "");
 }
 
-/***************** fmtTime ******************************************************
- * params: minutes
- * return: String
+/***************** printTime ****************************************************
+ * params: c, minutes
+ * return: void
  * Description:
- * Converts minutes since midnight into HH:MM.
+ * Writes minutes since midnight as HH:MM.
  ******************************************************************************/
-static String fmtTime(uint16_t minutes)
+static void printTime(HttpConn& c, uint16_t minutes)
 {
   uint16_t hh = minutes / 60;
   uint16_t mm = minutes % 60;
 
   char buf[6];
   snprintf(buf, sizeof(buf), "%02u:%02u", (unsigned)hh, (unsigned)mm);
-  return String(buf);
+  httpWrite(c, buf, 5);
 }
 
-/***************** renderIndex **************************************************
- * params: none
+/***************** handleIndex **************************************************
+ * params: c
  * return: void
  * Description:
  * Renders status & configuration page, including current heater state (ON/OFF)
  * and the current room (Base-Topic). Sends UTF-8 so special chars render fine.
+ * Only the dynamic HTML is sent here; CSS and JS live in web/ and are served
+ * pre-gzipped from /app.css and /app.js (see assets_gz.h). The page is
+ * produced card by card, one card per server pass.
  ******************************************************************************/
 static const char pageHeadStart[] PROGMEM = R"HTML(
 <!DOCTYPE html><html><head><meta charset='utf-8'>
@@ -104,65 +116,7 @@ static const char pageHeadStart[] PROGMEM = R"HTML(
 
 static const char pageHeadEnd[] PROGMEM = R"HTML(
 </title>
-<style>
-:root{--bg:#0b1220;--card:#101a33;--text:#e9eefc;--muted:#b7c2e8;--border:#223055;--temp-line:#fb923c;--upper-line:#22c55e;--lower-line:#60a5fa;--phase-line:#a855f7;--heat-band:rgba(239,68,68,0.16);--danger:var(--bad);--accent:#7aa2ff;--accent2:#64d2ff;--bad:#ff6b6b;--ok:#35d07f;--shadow-soft:0 10px 30px rgba(0,0,0,.35);}
-@media (prefers-color-scheme: light){:root{--bg:#f6f7fb;--card:#ffffff;--text:#1a2340;--muted:#58607a;--border:#d9ddec;--shadow-soft:0 8px 24px rgba(16,26,51,.12);}}
-body{font-family:system-ui,-apple-system,Segoe UI,Roboto,Ubuntu,Cantarell,Noto Sans,Helvetica,Arial,Apple Color Emoji,Segoe UI Emoji;margin:1rem;background:var(--bg);color:var(--text);transition:background .25s ease,color .25s ease;}
-h2{margin-bottom:.2rem;}
-.card{background:var(--card);border:1px solid var(--border);border-radius:.9rem;padding:1rem;box-shadow:var(--shadow-soft);margin-bottom:1rem;}
-.grid{display:grid;grid-template-columns:clamp(5.2rem,24vw,9.5rem) minmax(0,1fr) 2.6rem 2.6rem;column-gap:.4rem;row-gap:.55rem;align-items:center;}
-.grid>*{min-width:0;}
-.grid label{white-space:nowrap;overflow:hidden;text-overflow:ellipsis;}
-.grid input{height:2.2rem;padding:.4rem .6rem;min-width:0;box-sizing:border-box;}
-.grid .btn{height:2.3rem;min-width:2.3rem;width:2.3rem;padding:0;display:inline-flex;align-items:center;justify-content:center;}
-.btn{padding:.45rem .9rem;border:1px solid var(--border);border-radius:.7rem;background:transparent;color:var(--text);cursor:pointer;transition:transform .08s ease, background .15s ease,border-color .15s ease;min-height:2.3rem;}
-.btn:hover{background:rgba(122,162,255,.12);border-color:rgba(122,162,255,.55);}
-.btn:active{transform:translateY(1px);}
-input{padding:.45rem;border:1px solid var(--border);border-radius:.7rem;background:transparent;color:var(--text);width:100%;box-sizing:border-box;}
-.status-row{display:flex;gap:.6rem;flex-wrap:wrap;align-items:center;justify-content:space-between;}
-.status-item{padding:.5rem .75rem;border-radius:.7rem;border:1px solid var(--border);}
-.status-ok{border-color:rgba(53,208,127,.5);background:rgba(53,208,127,.08);}
-.status-bad{border-color:rgba(255,107,107,.5);background:rgba(255,107,107,.08);}
-.muted{color:var(--muted);}
-.split{display:grid;grid-template-columns:1fr 1fr;gap:1rem;}
-@media(max-width:840px){.split{grid-template-columns:1fr;}.grid{grid-template-columns:clamp(5.2rem,32vw,9rem) minmax(0,1fr) 2.4rem 2.4rem;column-gap:.4rem;row-gap:.45rem;}.card{padding:.9rem;}.grid input{height:2.1rem;}.grid .btn{height:2.2rem;min-width:2.2rem;width:2.2rem;}}
-@media(max-width:480px){.grid{grid-template-columns:clamp(4.8rem,34vw,7.5rem) minmax(0,1fr) 2.2rem 2.2rem;column-gap:.35rem;row-gap:.4rem;}th,td{padding:.35rem .3rem;}}
-.pill{display:inline-block;padding:.2rem .55rem;border-radius:999px;border:1px solid var(--border);font-size:.85rem;color:var(--muted);}
-.hr{height:1px;background:var(--border);margin:.8rem 0;opacity:.8;}
-details summary{cursor:pointer;color:var(--accent);}
-a{color:var(--accent2);text-decoration:none}
-.small{font-size:.9rem;}
-.viewBtns{display:flex;gap:.5rem;flex-wrap:wrap;margin:.4rem 0 .8rem 0;}
-.viewBtns .btn{padding:.35rem .7rem;font-size:.9rem;}
-table{width:100%;border-collapse:collapse;font-size:.92rem;}
-th,td{padding:.4rem .35rem;border-bottom:1px solid var(--border);text-align:left;}
-#histSvg .temp-line{stroke:var(--temp-line);fill:none;stroke-width:1.8;stroke-linecap:round;stroke-linejoin:round;}
-#histSvg .temp-glow{stroke:rgba(251,146,60,.35);fill:none;stroke-width:4;stroke-linecap:round;stroke-linejoin:round;}
-#histSvg .upper-line{stroke:var(--upper-line);fill:none;stroke-width:1;stroke-dasharray:4,4;}
-#histSvg .lower-line{stroke:var(--lower-line);fill:none;stroke-width:1;stroke-dasharray:4,4;}
-#histSvg .phase-line{stroke:var(--phase-line);fill:none;stroke-width:1;stroke-dasharray:4,4;opacity:.8;}
-#histSvg .axis{stroke:#6b7280;stroke-width:1;fill:none;}
-#histSvg .grid-line{stroke:rgba(148,163,184,.25);stroke-width:1;fill:none;}
-#histSvg .bg{fill:var(--bg);}
-#histSvg .axis-label{fill:var(--muted);font-size:10px;font-family:sans-serif;}
-#histSvg .hover-line{stroke:#e5e7eb;stroke-width:1;stroke-dasharray:2,2;}
-#histSvg .hover-dot{fill:var(--bad);}
-#histSvg .hover-text{fill:var(--text);font-size:11px;font-family:sans-serif;}
-.heat-on-band{fill:var(--heat-band);}
-/* remove number input spinners */
-input[type=number]
-{
-  -moz-appearance: textfield; /* Firefox */
-}
-
-input[type=number]::-webkit-inner-spin-button,
-input[type=number]::-webkit-outer-spin-button
-{
-  -webkit-appearance: none;
-  margin: 0;
-}
-
-</style>
+<link rel='stylesheet' href='/app.css?v=)HTML" APP_CSS_VER R"HTML('>
 </head><body>
 )HTML";
 
@@ -170,935 +124,1376 @@ static const char pageTail[] PROGMEM = R"HTML(
 </body></html>
 )HTML";
 
-static const char pageScript[] PROGMEM = R"JS(
-function postAction(url)
+static void renderHeaderCard(HttpConn& c)
 {
-  fetch(url,{method:'POST',cache:'no-store'})
-    .then(function(){window.location.replace('/');})
-    .catch(function(){window.location.replace('/');});
+  const float t = getLastTemperature();
+  const bool heaterIsOn = isHeaterOn();
+
+  httpPrint_P(c, pageHeadStart);
+  httpPrint(c, getBaseTopic());
+  httpPrint_P(c, pageHeadEnd);
+
+  // Header card
+  httpPrint_P(c, PSTR("<div class='card'><div class='status-row'><div><h2>Heizungssteuerung</h2><div class='muted small'>Raum: "));
+  httpPrint(c, getBaseTopic());
+  httpPrint_P(c, PSTR(" &middot; Version: "));
+  httpPrint(c, APP_VERSION);
+  httpPrint_P(c, PSTR(" &middot; Lokal: http://"));
+  httpPrint(c, getHostLabel());
+  httpPrint_P(c, PSTR(".local &middot; IP: "));
+  if (WiFi.isConnected())
+  {
+    const IPAddress ip = WiFi.localIP();
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    httpPrint(c, buf);
+  }
+  else
+  {
+    httpPrint_P(c, PSTR("offline"));
+  }
+  httpPrint_P(c, PSTR("</div></div>"));
+
+  // ids: live update from /events (app.js)
+  httpPrint_P(c, PSTR("<div id='stHeater' class='status-item "));
+  httpPrint(c, heaterIsOn ? "status-ok" : "status-bad");
+  httpPrint_P(c, PSTR("'>🔥 "));
+  httpPrint(c, heaterIsOn ? "Heizung EIN" : "Heizung AUS");
+  httpPrint_P(c, PSTR("</div>"));
+
+  httpPrint_P(c, PSTR("<button id='btnHeaterOff' class='btn' type='button'"));
+  if (!heaterIsOn)
+  {
+    httpPrint_P(c, PSTR(" hidden"));
+  }
+  httpPrint_P(c, PSTR(" onclick=\"if(confirm('Heizung wirklich ausschalten?')){postAction('/heaterOff');}\">🛑 Heizung ausschalten</button>"));
+
+  // MQTT + time status
+  httpPrint_P(c, PSTR("<div id='stMqtt' class='status-item "));
+  httpPrint(c, mqttIsConnected() ? "status-ok" : "status-bad");
+  httpPrint_P(c, PSTR("'>MQTT "));
+  httpPrint(c, mqttIsConnected() ? "Verbunden" : "Getrennt");
+  httpPrint_P(c, PSTR("</div>"));
+
+  httpPrint_P(c, PSTR("<div class='status-item'>Temperatur: <b><span id='stTemp'>"));
+  httpPrintFixed(c, t, 1);
+  httpPrint_P(c, PSTR("</span>&deg;C</b></div></div></div>"));
 }
 
-function nudge(field,delta)
+static void renderScheduleCard(HttpConn& c)
 {
-  var body='field='+encodeURIComponent(field)+'&delta='+encodeURIComponent(delta);
-  fetch('/nudge',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:body,cache:'no-store'})
-    .then(function(){window.location.replace('/');})
-    .catch(function(){window.location.replace('/');});
+  // Config card: schedule + setpoints
+  httpPrint_P(c, PSTR("<div class='card'><h3>Zeitplan</h3><div class='split'>"));
+
+  // Tagesbereich
+  httpPrint_P(c, PSTR("<div class='card'><h3>Tag</h3><div class='grid'><label>Soll (°C)</label>"
+                      "<input name='daySetPoint' type='number' step='0.5' min='5' max='35' value='"));
+  httpPrintFixed(c, getDaySetPoint(), 1);
+  httpPrint_P(c, PSTR("'>"
+                      "<button class='btn' type='button' onclick=\"nudge('daySetPoint',-0.5)\">-</button>"
+                      "<button class='btn' type='button' onclick=\"nudge('daySetPoint',0.5)\">+</button></div>"
+                      "<div class='grid'><label>Beginn</label>"
+                      "<input name='dayStart' type='time' step='300' value='"));
+  printTime(c, getDayStartMinutes());
+  httpPrint_P(c, PSTR("'>"
+                      "<span></span><span></span></div></div>"));
+
+  // Nachtbereich
+  httpPrint_P(c, PSTR("<div class='card'><h3>Nacht</h3><div class='grid'><label>Soll (°C)</label>"
+                      "<input name='nightSetPoint' type='number' step='0.1' min='5' max='35' value='"));
+  httpPrintFixed(c, getNightSetPoint(), 1);
+  httpPrint_P(c, PSTR("'>"
+                      "<button class='btn' type='button' onclick=\"nudge('nightSetPoint',-0.5)\">-</button>"
+                      "<button class='btn' type='button' onclick=\"nudge('nightSetPoint',0.5)\">+</button></div>"
+                      "<div class='grid'><label>Beginn</label>"
+                      "<input name='nightStart' type='time' step='300' value='"));
+  printTime(c, getNightStartMinutes());
+  httpPrint_P(c, PSTR("'>"
+                      "<span></span><span></span></div></div>"));
+
+  httpPrint_P(c, PSTR("</div><div class='hr'></div>"));
 }
 
-function formatTs(tsSec)
+static void renderControlCard(HttpConn& c)
 {
-  var d = new Date(tsSec * 1000);
-  return d.toLocaleDateString("de-DE",
-  {
-    day:   "2-digit",
-    month: "2-digit"
-  }) + " " +
-  d.toLocaleTimeString("de-DE",
+  // Hysteresis
+  httpPrint_P(c, PSTR("<div class='grid'><label>Hysterese (°C)</label>"
+                      "<input name='hysteresis' type='number' step='0.1' min='0.1' max='5.0' value='"));
+  httpPrintFixed(c, getHysteresis(), 1);
+  httpPrint_P(c, PSTR("'>"
+                      "<button class='btn' type='button' onclick=\"nudge('hysteresis',-0.1)\">-</button>"
+                      "<button class='btn' type='button' onclick=\"nudge('hysteresis',0.1)\">+</button></div>"
+                      "<div class='muted small'>Einschalttemperatur: <b><span id='stSp'>"));
+  httpPrintFixed(c, getSetPoint(), 1);
+  httpPrint_P(c, PSTR("</span> &deg;C</b> (Soll - Hysterese)</div>"));
+
+  // Boost minutes
+  httpPrint_P(c, PSTR("<div class='grid'><label>Boost (min)</label>"
+                      "<input name='boostMinutes' type='number' step='1' min='0' max='240' value='"));
+  httpPrintInt(c, getBoostMinutes());
+  httpPrint_P(c, PSTR("'>"
+                      "<button class='btn' type='button' onclick=\"nudge('boostMinutes',-5)\">-</button>"
+                      "<button class='btn' type='button' onclick=\"nudge('boostMinutes',5)\">+</button></div>"));
+
+  // Boost control (immer ausgeben, damit /events es einblenden kann)
+  const uint16_t boostMin = getStatus().boostMin;
+  httpPrint_P(c, PSTR("<p id='stBoost'"));
+  if (boostMin == 0)
   {
-    hour:   "2-digit",
-    minute: "2-digit"
-  });
+    httpPrint_P(c, PSTR(" hidden"));
+  }
+  httpPrint_P(c, PSTR(">Boost aktiv ~ <span id='stBoostMin'>"));
+  httpPrintInt(c, boostMin);
+  httpPrint_P(c, PSTR("</span> min verbleibend</p>"));
+
+  httpPrint_P(c, PSTR("<div><div class='grid'><label>Boost</label>"
+                      "<button class='btn' type='button' onclick=\"postAction('/boost')\">Starten</button>"
+                      "<span></span><span></span></div></div></div>"));
 }
 
-function formatTimeShort(tsSec)
+static void renderHistoryCard(HttpConn& c)
 {
-  var d = new Date(tsSec * 1000);
-  return d.toLocaleTimeString("de-DE",
+  // History card
+  httpPrint_P(c, PSTR("<div class='card'><div class='status-row'><h3>Verlauf</h3>"
+                      "<div class='viewBtns'><a href='/history.json?days=1'>"
+                      "<button class='btn' type='button'>Verlauf (1 Tag)</button></a>"
+                      "<a href='/history.csv?days=14&tier=raw'>"
+                      "<button class='btn' type='button'>CSV (14 Tage)</button></a>"
+                      "<button class='btn' type='button' data-view='chart'>Diagramm</button>"
+                      "<button class='btn' type='button' data-view='table'>Tabelle</button>"
+                      "</div></div>"
+                      "<div id='histChartWrap'>"
+                      "<svg id='histSvg' viewBox='0 0 600 320' preserveAspectRatio='xMidYMid meet' style='width:100%;height:auto;border:1px solid var(--border);border-radius:.75rem;'></svg>"
+                      "</div>"
+                      "<div id='histTableWrap' style='display:none;'></div>"
+                      "</div>"));
+
+  // JS
+  httpPrint_P(c, PSTR("<script>const schedCfg={dayStart:"));
+  httpPrintInt(c, getDayStartMinutes());
+  httpPrint_P(c, PSTR(",nightStart:"));
+  httpPrintInt(c, getNightStartMinutes());
+  httpPrint_P(c, PSTR(",daySet:"));
+  httpPrintFixed(c, getDaySetPoint(), 1);
+  httpPrint_P(c, PSTR(",nightSet:"));
+  httpPrintFixed(c, getNightSetPoint(), 1);
+  httpPrint_P(c, PSTR("};</script><script src='/app.js?v=" APP_JS_VER "'></script>"));
+
+  httpPrint_P(c, pageTail);
+}
+
+// Seite in Abschnitten, je ein Producer-Schritt (~1 KB)
+static void (*const indexParts[])(HttpConn& c) =
+{
+  renderHeaderCard, renderScheduleCard, renderControlCard, renderHistoryCard
+};
+
+static bool produceIndex(HttpConn& c)
+{
+  indexParts[c.step++](c);
+  return c.step < sizeof(indexParts) / sizeof(indexParts[0]);
+}
+
+static void handleIndex(HttpConn& c)
+{
+  httpStream(c, 200, "text/html; charset=utf-8", produceIndex, nullptr, nullptr);
+}
+
+/***************** sendGzAsset **************************************************
+ * params: c, data, len, type, etag
+ * return: void
+ * Description:
+ * Sends a gzip-compressed PROGMEM asset. The page links it with ?v=<hash>,
+ * so it may be cached for a year; a revalidation with a matching
+ * If-None-Match gets an empty 304.
+ ******************************************************************************/
+static void sendGzAsset(HttpConn& c, const uint8_t* data, size_t len, const char* type, const char* etag)
+{
+  httpAddHeader(c, "ETag", etag);
+  httpAddHeader(c, "Cache-Control", "public, max-age=31536000, immutable");
+  if (httpHeader(c, "If-None-Match") == etag)
   {
-    hour:   "2-digit",
-    minute: "2-digit"
-  });
+    httpSend(c, 304, nullptr, "");
+    return;
+  }
+  httpAddHeader(c, "Content-Encoding", "gzip");
+  httpSendP(c, 200, type, (PGM_P)data, len);
 }
 
-function formatTemp(val)
+static void handleAppCss(HttpConn& c)
 {
-  return Number(val).toFixed(1) + " °C";
+  sendGzAsset(c, APP_CSS_GZ, APP_CSS_GZ_LEN, APP_CSS_TYPE, APP_CSS_ETAG);
 }
 
-function normalizeHistory(history)
-{
-  return history.map(function(s){
-    return {
-      ts: s.ts,
-      tC: s.t / 100.0,
-      spC: s.sp / 100.0,
-      hyC: s.hy / 100.0,
-      h: s.h
-    };
-  }).sort(function(a, b){ return a.ts - b.ts; });
+static void handleAppJs(HttpConn& c)
+{
+  sendGzAsset(c, APP_JS_GZ, APP_JS_GZ_LEN, APP_JS_TYPE, APP_JS_ETAG);
 }
 
-function buildHistoryTable(history)
+/***************** historyRecordCount *******************************************
+ * params: days
+ * return: size_t
+ * Description:
+ * Number of log records covering the given number of days.
+ ******************************************************************************/
+static size_t historyRecordCount(int days)
 {
-  var HEATER_OFF = 0;
-  var HEATER_ON  = 1;
+  const unsigned long intervalMin  = (unsigned long)LOG_INTERVAL_MINUTES;
+  const unsigned long totalMinutes = (unsigned long)days * 24UL * 60UL;
 
-  var state = HEATER_OFF;
-  var onTs = 0;
-  var onTemp = 0;
-  var onSp = 0;
-  var onHy = 0;
-  var rows = [];
+  return (totalMinutes + intervalMin - 1UL) / intervalMin;
+}
 
-  history.forEach(function(s){
-    var heaterOn = (s.h !== 0);
-    if (state === HEATER_OFF)
-    {
-      if (heaterOn)
-      {
-        onTs = s.ts;
-        onTemp = s.tC;
-        onSp = s.spC;
-        onHy = s.hyC;
-        state = HEATER_ON;
-      }
-      return;
-    }
+/***************** makeLiveSample ***********************************************
+ * params: out
+ * return: bool
+ * Description:
+ * Builds a sample from the current readings (used while history is empty).
+ ******************************************************************************/
+static bool makeLiveSample(LogSample& out)
+{
+  const float currentTemp = getLastTemperature();
+  if (isnan(currentTemp))
+  {
+    return false;
+  }
+  out.tsSec           = getEpochOrUptimeSec();
+  out.tempCenti       = (int16_t)roundf(currentTemp * 100.0f);
+  out.setPointCenti   = (int16_t)roundf(getSetPoint() * 100.0f);
+  out.hysteresisCenti = (int16_t)roundf(getHysteresis() * 100.0f);
+  out.flags           = isHeaterOn() ? 0x01 : 0x00;
+  out.seq             = 0;
+  return true;
+}
+
+struct BinHistState;
+
+/***************** writeSampleJson **********************************************
+ * params: w, st, s, index
+ * return: void
+ * Description:
+ * Appends one sample as a compact JSON object.
+ ******************************************************************************/
+static void writeSampleJson(HttpConn& w, BinHistState& st, const LogSample& s, size_t index)
+{
+  char rec[72];
+  const int n = snprintf(rec, sizeof(rec), "%s{\"ts\":%lu,\"t\":%d,\"sp\":%d,\"hy\":%d,\"h\":%c}",
+                         index == 0 ? "" : ",",
+                         (unsigned long)s.tsSec, (int)s.tempCenti, (int)s.setPointCenti,
+                         (int)s.hysteresisCenti, (s.flags & 0x01) ? '1' : '0');
+  if (n > 0)
+  {
+    httpWrite(w, rec, (size_t)n);
+  }
+}
+
+/***************** writeRollupJson **********************************************
+ * params: w, st, s, index
+ * return: void
+ * Description:
+ * Appends one rollup bucket. Carries the same keys as a raw sample (t = mean,
+ * h = heater on for most of the bucket) plus mn/mx and duty d in percent.
+ ******************************************************************************/
+static void writeRollupJson(HttpConn& w, BinHistState& st, const RollupSample& s, size_t index)
+{
+  char rec[112];
+  const int n = snprintf(rec, sizeof(rec),
+                         "%s{\"ts\":%lu,\"t\":%d,\"sp\":%d,\"hy\":%d,\"h\":%c,\"mn\":%d,\"mx\":%d,\"d\":%u}",
+                         index == 0 ? "" : ",",
+                         (unsigned long)s.tsSec, (int)s.tAvgCenti, (int)s.spAvgCenti,
+                         (int)s.hyAvgCenti, (s.dutyPct >= 50) ? '1' : '0',
+                         (int)s.tMinCenti, (int)s.tMaxCenti, (unsigned)s.dutyPct);
+  if (n > 0)
+  {
+    httpWrite(w, rec, (size_t)n);
+  }
+}
 
-    if (!heaterOn)
+/***************** Binary history encoding **************************************
+ * Description:
+ * /history.bin layout (all integers LEB128 varints, signed ones zig-zag):
+ *   'H' 'B' 0x01            magic + format version
+ *   varint intervalSec      nominal spacing (sample interval or bucket length)
+ *   per record:
+ *     byte  tag             bit0 heaterOn, bit1 sp/hy follow, bit2 ts delta
+ *                           follows, bit3 rollup extras follow
+ *     [zz]  dTs             ts - prevTs - intervalSec        (only if bit2)
+ *     zz    dTemp           tempCenti - prevTemp (mean for rollups)
+ *     [zz]  dSp, dHy        setPoint/hysteresis deltas       (only if bit1)
+ *     [zz]  min-mean, max-mean; byte duty%                   (only if bit3)
+ * All "prev" values start at 0, so the first record carries them absolutely.
+ ******************************************************************************/
+struct BinHistState
+{
+  uint32_t interval;
+  uint32_t ts;
+  int16_t  temp;
+  int16_t  sp;
+  int16_t  hy;
+};
+
+static void writeVarint(HttpConn& w, uint64_t v)
+{
+  char b[10];
+  size_t n = 0;
+  do
+  {
+    uint8_t byte = v & 0x7F;
+    v >>= 7;
+    if (v)
     {
-      var offTs = s.ts;
-      var offTemp = s.tC;
-      rows.push({
-        onTime: formatTs(onTs),
-        offTime: formatTs(offTs),
-        tempOn: onTemp.toFixed(1) + " °C",
-        tempOff: offTemp.toFixed(1) + " °C",
-        thresh: (onSp - onHy).toFixed(1) + " °C / " + onSp.toFixed(1) + " °C"
-      });
-      state = HEATER_OFF;
+      byte |= 0x80;
     }
-  });
+    b[n++] = (char)byte;
+  }
+  while (v);
+  httpWrite(w, b, n);
+}
 
-  return rows;
+static void writeZigZag(HttpConn& w, int64_t v)
+{
+  writeVarint(w, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63));
 }
 
-(function(){
-  var svg = document.getElementById('histSvg');
-  var tableWrap = document.getElementById('histTableWrap');
-  var chartWrap = document.getElementById('histChartWrap');
-  var viewBtns = document.querySelectorAll('[data-view]');
-  if (!svg || !tableWrap || !chartWrap)
+/***************** writeBinRecord ***********************************************
+ * params: w, st, s, index, extraTag
+ * return: void
+ * Description:
+ * Appends the common part of one record in the delta/varint format.
+ ******************************************************************************/
+static void writeBinRecord(HttpConn& w, BinHistState& st, const LogSample& s, size_t index, uint8_t extraTag)
+{
+  const int64_t dTs = (int64_t)s.tsSec - (int64_t)st.ts - (int64_t)st.interval;
+  const bool spChanged = (index == 0) || s.setPointCenti != st.sp || s.hysteresisCenti != st.hy;
+
+  uint8_t tag = ((s.flags & 0x01) ? 0x01 : 0x00) | extraTag;
+  if (spChanged) tag |= 0x02;
+  if (dTs != 0)  tag |= 0x04;
+  httpWrite(w, (const char*)&tag, 1);
+
+  if (dTs != 0)
   {
+    writeZigZag(w, dTs);
+  }
+  writeZigZag(w, (int64_t)s.tempCenti - st.temp);
+  if (spChanged)
+  {
+    writeZigZag(w, (int64_t)s.setPointCenti - st.sp);
+    writeZigZag(w, (int64_t)s.hysteresisCenti - st.hy);
+  }
+
+  st.ts   = s.tsSec;
+  st.temp = s.tempCenti;
+  st.sp   = s.setPointCenti;
+  st.hy   = s.hysteresisCenti;
+}
+
+static void writeSampleBin(HttpConn& w, BinHistState& st, const LogSample& s, size_t index)
+{
+  writeBinRecord(w, st, s, index, 0);
+}
+
+static void writeRollupBin(HttpConn& w, BinHistState& st, const RollupSample& r, size_t index)
+{
+  LogSample s;
+  s.tsSec           = r.tsSec;
+  s.tempCenti       = r.tAvgCenti;
+  s.setPointCenti   = r.spAvgCenti;
+  s.hysteresisCenti = r.hyAvgCenti;
+  s.flags           = (r.dutyPct >= 50) ? 0x01 : 0x00;
+  s.seq             = 0;
+  writeBinRecord(w, st, s, index, 0x08);
+
+  writeZigZag(w, (int64_t)r.tMinCenti - r.tAvgCenti);
+  writeZigZag(w, (int64_t)r.tMaxCenti - r.tAvgCenti);
+  httpWrite(w, (const char*)&r.dutyPct, 1);
+}
+
+/***************** parseEpochArg ************************************************
+ * params: c, name, fallback
+ * return: uint32_t
+ * Description:
+ * Reads an unsigned epoch-seconds query parameter.
+ ******************************************************************************/
+static uint32_t parseEpochArg(const HttpConn& c, const char* name, uint32_t fallback)
+{
+  if (!httpHasArg(c, name))
+  {
+    return fallback;
+  }
+  return (uint32_t)strtoul(httpArg(c, name).c_str(), nullptr, 10);
+}
+
+/***************** HistoryQuery *************************************************
+ * Description:
+ * A resolved history request: tier plus a cursor into that tier.
+ ******************************************************************************/
+struct HistoryQuery
+{
+  HistoryTier   tier;
+  HistoryCursor cursor;
+  size_t        count;
+  int           days;
+  size_t        maxPoints;   // 0 = alle Records senden
+  bool          incremental; // since/afterSeq: nur Neues, kein Live-Sample
+};
+
+/***************** openHistoryQuery *********************************************
+ * params: c, q
+ * return: void
+ * Description:
+ * Resolves the request parameters:
+ * - from/to (epoch seconds, either optional) -> time window
+ * - days (1..14) -> time window ending now once NTP is synced, otherwise the
+ *   last days*24h/LOG_INTERVAL_MINUTES raw records
+ * - tier=raw|hour|day forces a tier; default picks the finest tier that
+ *   covers the window within maxPoints (or HISTORY_MAX_POINTS) points.
+ * - maxPoints (3..HISTORY_MAX_POINTS_LIMIT) -> LTTB decimation, see
+ *   streamHistory()
+ * - afterSeq=n (raw tier only) -> raw samples from sample number n on, n being
+ *   the X-History-Cursor of the previous response
+ * - since=ts -> samples with ts > since, same as from=since+1 (empty for
+ *   since=4294967295)
+ ******************************************************************************/
+static void openHistoryQuery(const HttpConn& c, HistoryQuery& q)
+{
+  uint32_t fromTs = 0;
+  uint32_t toTs   = UINT32_MAX;
+  q.tier = TIER_RAW;
+  q.days = 0;
+  q.maxPoints = 0;
+  q.incremental = false;
+
+  if (httpHasArg(c, "maxPoints"))
+  {
+    q.maxPoints = (size_t)clampInt(httpArg(c, "maxPoints").toInt(), 3, HISTORY_MAX_POINTS_LIMIT);
+  }
+
+  if (httpHasArg(c, "afterSeq"))
+  {
+    q.incremental = true;
+    q.count = openHistoryFrom(q.cursor, parseEpochArg(c, "afterSeq", 0));
     return;
   }
 
-  function setView(mode)
+  if (httpHasArg(c, "since"))
   {
-    if (mode === 'table')
+    q.incremental = true;
+    const uint32_t since = parseEpochArg(c, "since", 0);
+    if (since == UINT32_MAX)
     {
-      chartWrap.style.display = 'none';
-      tableWrap.style.display = 'block';
+      fromTs = UINT32_MAX;       // nichts kann neuer sein: leeres Fenster,
+      toTs   = UINT32_MAX - 1;   // statt Überlauf auf 0 (= ganze Historie)
     }
     else
     {
-      chartWrap.style.display = 'block';
-      tableWrap.style.display = 'none';
+      fromTs = since + 1;
     }
   }
-
-  viewBtns.forEach(function(b){
-    b.addEventListener('click', function(){
-      setView(b.getAttribute('data-view'));
-    });
-  });
-
-  function fetchHistory()
+  else if (httpHasArg(c, "from") || httpHasArg(c, "to"))
   {
-    return fetch('/history.json?days=1', { cache: 'no-store' })
-      .then(function(r){ return r.json(); });
+    fromTs = parseEpochArg(c, "from", 0);
+    toTs   = parseEpochArg(c, "to", UINT32_MAX);
   }
-
-  function clearSvg()
+  else
   {
-    while (svg.firstChild)
+    const int daysParam = httpHasArg(c, "days") ? httpArg(c, "days").toInt() : 5;
+    q.days = clampInt(daysParam, 1, 14);
+
+    if (!isTimeSynced())
     {
-      svg.removeChild(svg.firstChild);
+      q.count = (LOG_INTERVAL_MINUTES > 0) ? openHistoryTail(q.cursor, historyRecordCount(q.days)) : 0;
+      return;
     }
+    fromTs = getEpochNow() - (uint32_t)q.days * 86400UL;
   }
 
-  function drawText(x,y,txt,cls)
+  const String tierArg = httpArg(c, "tier");
+  if (tierArg == "raw")
   {
-    var t = document.createElementNS('http://www.w3.org/2000/svg','text');
-    t.setAttribute('x', x);
-    t.setAttribute('y', y);
-    t.textContent = txt;
-    t.setAttribute('fill', 'currentColor');
-    t.setAttribute('font-size', '12');
-    if (cls)
-    {
-      t.setAttribute('class', cls);
-    }
-    svg.appendChild(t);
-    return t;
+    q.tier = TIER_RAW;
   }
-
-  function drawLine(x1,y1,x2,y2,stroke,width)
+  else if (tierArg == "hour")
+  {
+    q.tier = TIER_HOURLY;
+  }
+  else if (tierArg == "day")
+  {
+    q.tier = TIER_DAILY;
+  }
+  else
   {
-    var l = document.createElementNS('http://www.w3.org/2000/svg','line');
-    l.setAttribute('x1', x1);
-    l.setAttribute('y1', y1);
-    l.setAttribute('x2', x2);
-    l.setAttribute('y2', y2);
-    l.setAttribute('stroke', stroke);
-    l.setAttribute('stroke-width', width || 1);
-    l.setAttribute('opacity', '0.5');
-    svg.appendChild(l);
-    return l;
+    q.tier = pickHistoryTier(fromTs, toTs, q.maxPoints > 0 ? q.maxPoints : HISTORY_MAX_POINTS);
   }
 
-  function drawPath(d,stroke,width)
+  q.count = (q.tier == TIER_RAW) ? openHistoryRange(q.cursor, fromTs, toTs)
+                                 : openRollupRange(q.tier, q.cursor, fromTs, toTs);
+}
+
+/***************** CSV history **************************************************
+ * Description:
+ * /history.csv: one header row, then one row per sample or bucket.
+ * Columns: ts (epoch or uptime s), local (YYYY-MM-DD HH:MM:SS, empty for
+ * uptime stamps), temp_c, set_point_c, hysteresis_c, on_below_c and
+ * off_above_c (switching thresholds as in handleControl(): heater on at
+ * temp <= sp - hy, off at temp >= sp + hy), heater (0/1).
+ * Rollup tiers add temp_min_c, temp_max_c, duty_pct; heater is then 1 when
+ * the heater ran for most of the bucket.
+ ******************************************************************************/
+static const uint32_t CSV_EPOCH_MIN = 1609459200UL; // wie validEpoch() in ntp.cpp
+
+// Centi-Wert als Dezimalzahl ("-3.05"), ohne float
+static int formatCenti(char* buf, size_t len, int32_t centi)
+{
+  const uint32_t a = (centi < 0) ? (uint32_t)-centi : (uint32_t)centi;
+  return snprintf(buf, len, "%s%lu.%02lu", centi < 0 ? "-" : "",
+                  (unsigned long)(a / 100), (unsigned long)(a % 100));
+}
+
+/***************** writeCsvCommon ***********************************************
+ * params: w, ts, tempCenti, spCenti, hyCenti, heater
+ * return: void
+ * Description:
+ * Writes the columns shared by raw and rollup rows (without line end).
+ ******************************************************************************/
+static void writeCsvCommon(HttpConn& w, uint32_t ts, int16_t tempCenti, int16_t spCenti, int16_t hyCenti, bool heater)
+{
+  char local[20] = "";
+  if (ts >= CSV_EPOCH_MIN)
   {
-    var p = document.createElementNS('http://www.w3.org/2000/svg','path');
-    p.setAttribute('d', d);
-    p.setAttribute('fill', 'none');
-    p.setAttribute('stroke', stroke);
-    p.setAttribute('stroke-width', width || 2);
-    svg.appendChild(p);
-    return p;
+    const time_t t = (time_t)ts;
+    struct tm lt;
+    localtime_r(&t, &lt);
+    strftime(local, sizeof(local), "%Y-%m-%d %H:%M:%S", &lt);
   }
 
-  function renderTable(rows)
+  char t[8], sp[8], hy[8], lo[8], hi[8];
+  formatCenti(t,  sizeof(t),  tempCenti);
+  formatCenti(sp, sizeof(sp), spCenti);
+  formatCenti(hy, sizeof(hy), hyCenti);
+  formatCenti(lo, sizeof(lo), (int32_t)spCenti - hyCenti);
+  formatCenti(hi, sizeof(hi), (int32_t)spCenti + hyCenti);
+
+  char row[96];
+  const int n = snprintf(row, sizeof(row), "%lu,%s,%s,%s,%s,%s,%s,%c",
+                         (unsigned long)ts, local, t, sp, hy, lo, hi, heater ? '1' : '0');
+  if (n > 0)
   {
-    var tableRows = buildHistoryTable(rows);
-    if (!tableRows.length)
-    {
-      tableWrap.innerHTML = "<div class='muted'>Keine Heizphasen im Verlauf</div>";
-      return;
-    }
+    httpWrite(w, row, ((size_t)n < sizeof(row)) ? (size_t)n : sizeof(row) - 1);
+  }
+}
+
+static void writeSampleCsv(HttpConn& w, BinHistState& st, const LogSample& s, size_t index)
+{
+  writeCsvCommon(w, s.tsSec, s.tempCenti, s.setPointCenti, s.hysteresisCenti, (s.flags & 0x01) != 0);
+  httpWrite(w, "\r\n", 2);
+}
+
+static void writeRollupCsv(HttpConn& w, BinHistState& st, const RollupSample& s, size_t index)
+{
+  writeCsvCommon(w, s.tsSec, s.tAvgCenti, s.spAvgCenti, s.hyAvgCenti, s.dutyPct >= 50);
 
-    var html = "<table><thead><tr><th>Ein</th><th>Aus</th><th>Temp Ein</th><th>Temp Aus</th><th>Schwelle</th></tr></thead><tbody>";
-    tableRows.forEach(function(r){
-      html += "<tr><td>" + r.onTime + "</td><td>" + r.offTime + "</td><td>" + r.tempOn + "</td><td>" + r.tempOff + "</td><td>" + r.thresh + "</td></tr>";
-    });
-    html += "</tbody></table>";
-    tableWrap.innerHTML = html;
+  char mn[8], mx[8], rest[32];
+  formatCenti(mn, sizeof(mn), s.tMinCenti);
+  formatCenti(mx, sizeof(mx), s.tMaxCenti);
+  const int n = snprintf(rest, sizeof(rest), ",%s,%s,%u\r\n", mn, mx, (unsigned)s.dutyPct);
+  if (n > 0)
+  {
+    httpWrite(w, rest, (size_t)n);
   }
+}
 
-  function renderChart(rows)
+static void writeCsvPrefix(HttpConn& w, BinHistState& st, const HistoryQuery& q)
+{
+  httpPrint_P(w, PSTR("ts,local,temp_c,set_point_c,hysteresis_c,on_below_c,off_above_c,heater"));
+  if (q.tier != TIER_RAW)
   {
-    clearSvg();
-    if (!rows.length)
-    {
-      var txt = document.createElementNS('http://www.w3.org/2000/svg', 'text');
-      txt.setAttribute('x', '10');
-      txt.setAttribute('y', '20');
-      txt.textContent = 'Keine Verlaufsdaten verfügbar.';
-      svg.appendChild(txt);
-      return;
-    }
+    httpPrint_P(w, PSTR(",temp_min_c,temp_max_c,duty_pct"));
+  }
+  httpWrite(w, "\r\n", 2);
+}
 
-    var width = 600;
-    var height = 320;
-    var padL = 50, padR = 10, padT = 10, padB = 30;
+/***************** HistoryFormat ************************************************/
+struct HistoryFormat
+{
+  const char* contentType;
+  const char* suffix;
+  void (*writeSample)(HttpConn& w, BinHistState& st, const LogSample& s, size_t index);
+  void (*writeRollup)(HttpConn& w, BinHistState& st, const RollupSample& s, size_t index);
+  void (*writePrefix)(HttpConn& w, BinHistState& st, const HistoryQuery& q);
+};
+
+static void writeJsonPrefix(HttpConn& w, BinHistState& st, const HistoryQuery& q)
+{
+  httpPrint(w, "[");
+}
 
-    var maxTs = Number(rows[rows.length - 1].ts) || 0;
-    var minTs = maxTs > 86400 ? (maxTs - 86400) : 0;
+static void writeBinPrefix(HttpConn& w, BinHistState& st, const HistoryQuery& q)
+{
+  const char magic[3] = { 'H', 'B', 0x01 };
+  httpWrite(w, magic, sizeof(magic));
 
-    var filtered = [];
-    var lastBefore = null;
-    for (var i = 0; i < rows.length; i++)
-    {
-      var r = rows[i];
-      var tsVal = Number(r.ts) || 0;
-      if (tsVal < minTs)
-      {
-        lastBefore = r;
-        continue;
-      }
-      if (tsVal > maxTs)
-      {
-        continue;
-      }
-      filtered.push(r);
-    }
+  st = BinHistState{};
+  st.interval = tierBucketSec(q.tier);
+  writeVarint(w, st.interval);
+}
 
-    if (lastBefore && filtered.length)
-    {
-      filtered.unshift({
-        ts: minTs,
-        tC: lastBefore.tC,
-        spC: lastBefore.spC,
-        hyC: lastBefore.hyC,
-        h: lastBefore.h
-      });
-    }
+static const HistoryFormat FMT_JSON = { "application/json", "]", writeSampleJson, writeRollupJson, writeJsonPrefix };
+static const HistoryFormat FMT_BIN  = { "application/octet-stream", "", writeSampleBin, writeRollupBin, writeBinPrefix };
+static const HistoryFormat FMT_CSV  = { "text/csv; charset=utf-8", "", writeSampleCsv, writeRollupCsv, writeCsvPrefix };
 
-    if (!filtered.length)
-    {
-      filtered = rows.slice(-1);
-    }
+/***************** HistoryJob ***************************************************
+ * Description:
+ * State of one history response between producer steps (~1.3 KB, heap, one
+ * per request so several downloads can interleave). Raw samples run through
+ * the LTTB stream as RollupSample (min = max = avg, duty 0/100) and are
+ * turned back into LogSample on the way out, so both tiers share one
+ * decimation path and the output format does not change.
+ ******************************************************************************/
+struct HistoryJob
+{
+  HttpConn*            conn;
+  const HistoryFormat* fmt;
+  HistoryQuery         q;
+  BinHistState         bin;
+  LttbStream           lttb;
+  size_t               written;
+  uint32_t             minFreeHeap;
+  bool                 haveLive;
+  LogSample            live;
+};
+
+static void sampleToRollup(const LogSample& s, RollupSample& r)
+{
+  r.tsSec           = s.tsSec;
+  r.tMinCenti       = s.tempCenti;
+  r.tMaxCenti       = s.tempCenti;
+  r.tAvgCenti       = s.tempCenti;
+  r.spAvgCenti      = s.setPointCenti;
+  r.hyAvgCenti      = s.hysteresisCenti;
+  r.samples         = 1;
+  r.dutyPct         = (s.flags & 0x01) ? 100 : 0;
+}
 
-    var temps = [];
-    var uppers = [];
-    var lowers = [];
-    var tsList = [];
-    var onList = [];
+static void emitLttbPoint(const RollupSample& r, void* ctx)
+{
+  HistoryJob& j = *(HistoryJob*)ctx;
+  if (j.q.tier != TIER_RAW)
+  {
+    j.fmt->writeRollup(*j.conn, j.bin, r, j.written++);
+    return;
+  }
 
-    for (var j = 0; j < filtered.length; j++)
-    {
-      var fr = filtered[j];
-      var tVal = Number(fr.tC) || 0;
-      var spVal = Number(fr.spC) || 0;
-      var hyVal = Number(fr.hyC) || 0;
-      var on = fr.h ? true : false;
-
-      temps.push(tVal);
-      uppers.push(spVal + hyVal);
-      lowers.push(spVal - hyVal);
-      tsList.push(Number(fr.ts) || 0);
-      onList.push(on);
-    }
+  LogSample s;
+  s.tsSec           = r.tsSec;
+  s.tempCenti       = r.tAvgCenti;
+  s.setPointCenti   = r.spAvgCenti;
+  s.hysteresisCenti = r.hyAvgCenti;
+  s.flags           = (r.dutyPct >= 50) ? 0x01 : 0x00;
+  s.seq             = 0;
+  j.fmt->writeSample(*j.conn, j.bin, s, j.written++);
+}
 
-    var allVals = temps.concat(uppers).concat(lowers);
-    var minV = allVals[0];
-    var maxV = allVals[0];
-    for (var k = 1; k < allVals.length; k++)
-    {
-      if (allVals[k] < minV) { minV = allVals[k]; }
-      if (allVals[k] > maxV) { maxV = allVals[k]; }
-    }
-    if (maxV - minV < 0.5)
-    {
-      minV -= 0.5;
-      maxV += 0.5;
-    }
-    var vSpan = maxV - minV;
+static void releaseHistoryJob(void* ctx)
+{
+  delete (HistoryJob*)ctx;
+}
 
-    minTs = minTs || tsList[0];
-    maxTs = maxTs || tsList[tsList.length - 1];
-    if (maxTs <= minTs)
-    {
-      maxTs = minTs + 86400;
-    }
-    var tsSpan = maxTs - minTs;
+/***************** produceHistory ***********************************************
+ * params: c
+ * return: bool
+ * Description:
+ * One step of a history response: step 0 writes the prefix, step 1 feeds
+ * up to HISTORY_STEP_RECORDS records through LTTB until the chunk is about
+ * full, step 2 closes the stream.
+ ******************************************************************************/
+static bool produceHistory(HttpConn& c)
+{
+  HistoryJob& j = *(HistoryJob*)c.ctx;
 
-    function xForTs(ts)
+  const uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < j.minFreeHeap)
+  {
+    j.minFreeHeap = freeHeap;
+  }
+
+  if (c.step == 0)
+  {
+    j.fmt->writePrefix(c, j.bin, j.q);
+    if (j.haveLive)
     {
-      var rel = (ts - minTs) / tsSpan;
-      return padL + rel * (width - padL - padR);
+      /* fallback: no history yet → inject live sample */
+      j.fmt->writeSample(c, j.bin, j.live, 0);
+      j.written = 1;
+      c.step = 2;
     }
-
-    function yFor(val)
+    else
     {
-      var rel = (val - minV) / vSpan;
-      var inv = 1.0 - rel;
-      return padT + inv * (height - padT - padB);
+      lttbBegin(j.lttb, j.q.count, j.q.maxPoints, emitLttbPoint, &j);
+      c.step = 1;
     }
+  }
 
-    var bg = document.createElementNS('http://www.w3.org/2000/svg', 'rect');
-    bg.setAttribute('x', '0');
-    bg.setAttribute('y', '0');
-    bg.setAttribute('width', width);
-    bg.setAttribute('height', height);
-    bg.setAttribute('class', 'bg');
-    svg.appendChild(bg);
-
-    var segments = [];
-    var segStart = null;
-    for (var s = 0; s < tsList.length; s++)
+  size_t fed = 0;
+  while (c.step == 1 && fed < HISTORY_STEP_RECORDS && httpTxFree(c) >= HISTORY_STEP_MIN_FREE)
+  {
+    size_t n;
+    if (j.q.tier == TIER_RAW)
     {
-      if (onList[s])
-      {
-        if (segStart === null)
-        {
-          segStart = tsList[s];
-        }
-      }
-      else if (segStart !== null)
+      LogSample recs[16];
+      RollupSample r;
+      n = readHistoryCursor(j.q.cursor, recs, 16);
+      for (size_t i = 0; i < n; i++)
       {
-        segments.push({ start: segStart, end: tsList[s] });
-        segStart = null;
+        sampleToRollup(recs[i], r);
+        lttbPush(j.lttb, r);
       }
     }
-    if (segStart !== null)
-    {
-      segments.push({ start: segStart, end: tsList[tsList.length - 1] });
-    }
-
-    for (var si = 0; si < segments.length; si++)
+    else
     {
-      var seg = segments[si];
-      var x1 = xForTs(seg.start);
-      var x2 = xForTs(seg.end);
-      if (x2 <= x1)
+      RollupSample recs[16];
+      n = readRollupCursor(j.q.tier, j.q.cursor, recs, 16);
+      for (size_t i = 0; i < n; i++)
       {
-        x2 = x1 + 1;
+        lttbPush(j.lttb, recs[i]);
       }
-      var band = document.createElementNS('http://www.w3.org/2000/svg', 'rect');
-      band.setAttribute('x', x1);
-      band.setAttribute('y', padT);
-      band.setAttribute('width', x2 - x1);
-      band.setAttribute('height', height - padT - padB);
-      band.setAttribute('class', 'heat-on-band');
-      svg.appendChild(band);
     }
-
-    var yTicks = 5;
-    for (var t = 0; t < yTicks; t++)
+    fed += n;
+    if (n == 0)
     {
-      var val = minV + (vSpan * (t / (yTicks - 1)));
-      var y = yFor(val);
-
-      var gl = document.createElementNS('http://www.w3.org/2000/svg', 'line');
-      gl.setAttribute('x1', padL);
-      gl.setAttribute('y1', y);
-      gl.setAttribute('x2', width - padR);
-      gl.setAttribute('y2', y);
-      gl.setAttribute('class', 'grid-line');
-      svg.appendChild(gl);
-
-      var lbl = document.createElementNS('http://www.w3.org/2000/svg', 'text');
-      lbl.setAttribute('x', padL - 4);
-      lbl.setAttribute('y', y + 3);
-      lbl.setAttribute('text-anchor', 'end');
-      lbl.setAttribute('class', 'axis-label');
-      lbl.textContent = val.toFixed(1);
-      svg.appendChild(lbl);
+      lttbEnd(j.lttb);
+      c.step = 2;
     }
+  }
 
-    var axisX = document.createElementNS('http://www.w3.org/2000/svg', 'line');
-    axisX.setAttribute('x1', padL);
-    axisX.setAttribute('y1', height - padB);
-    axisX.setAttribute('x2', width - padR);
-    axisX.setAttribute('y2', height - padB);
-    axisX.setAttribute('class', 'axis');
-    svg.appendChild(axisX);
-
-    var tickStep = 4 * 3600;
-    var firstTick = Math.ceil(minTs / tickStep) * tickStep;
-    for (var ts = firstTick; ts <= maxTs + 1; ts += tickStep)
-    {
-      var x = xForTs(ts);
-      var tick = document.createElementNS('http://www.w3.org/2000/svg', 'line');
-      tick.setAttribute('x1', x);
-      tick.setAttribute('y1', height - padB);
-      tick.setAttribute('x2', x);
-      tick.setAttribute('y2', height - padB + 4);
-      tick.setAttribute('class', 'axis');
-      svg.appendChild(tick);
-
-      var tl = document.createElementNS('http://www.w3.org/2000/svg', 'text');
-      tl.setAttribute('x', x);
-      tl.setAttribute('y', height - padB + 14);
-      tl.setAttribute('text-anchor', 'middle');
-      tl.setAttribute('class', 'axis-label');
-      tl.textContent = formatTimeShort(ts);
-      svg.appendChild(tl);
-    }
+  if (c.step != 2)
+  {
+    return true;
+  }
 
-    function buildTransitions(minTs, maxTs)
-    {
-      var list = [];
-      var dayStart = Number(schedCfg.dayStart) || 0;
-      var nightStart = Number(schedCfg.nightStart) || 0;
-      var startDay = Math.floor(minTs / 86400) * 86400 - 86400;
-      var end = maxTs + 86400;
-      for (var base = startDay; base <= end; base += 86400)
-      {
-        list.push({ ts: base + dayStart * 60, label: 'Tag' });
-        list.push({ ts: base + nightStart * 60, label: 'Nacht' });
-      }
-      return list;
-    }
+  httpPrint(c, j.fmt->suffix);
+  Serial.printf("[WEB] %s days=%d tier=%d records=%u points=%u minFreeHeap=%lu\n",
+                c.path, j.q.days, (int)j.q.tier, (unsigned)j.q.count,
+                (unsigned)j.written, (unsigned long)j.minFreeHeap);
+  return false;
+}
 
-    var transitions = buildTransitions(minTs, maxTs);
-    for (var ti = 0; ti < transitions.length; ti++)
-    {
-      var tr = transitions[ti];
-      if (tr.ts < minTs || tr.ts > maxTs) { continue; }
-      var xTr = xForTs(tr.ts);
-      var pl = document.createElementNS('http://www.w3.org/2000/svg', 'line');
-      pl.setAttribute('x1', xTr);
-      pl.setAttribute('y1', padT);
-      pl.setAttribute('x2', xTr);
-      pl.setAttribute('y2', height - padB);
-      pl.setAttribute('class', 'phase-line');
-      svg.appendChild(pl);
-
-      var lblPhase = document.createElementNS('http://www.w3.org/2000/svg', 'text');
-      lblPhase.setAttribute('x', xTr + 2);
-      lblPhase.setAttribute('y', padT + 12 + (ti % 2) * 12);
-      lblPhase.setAttribute('class', 'axis-label');
-      lblPhase.textContent = formatTimeShort(tr.ts) + ' ' + tr.label;
-      svg.appendChild(lblPhase);
-    }
+/***************** streamHistory ************************************************
+ * params: c, fmt
+ * return: void
+ * Description:
+ * Shared body of the history endpoints: resolves the query (see
+ * openHistoryQuery()), then streams the matching samples or buckets (or one
+ * live sample while history is empty) with chunked transfer encoding, one
+ * buffer per server pass (see produceHistory()). Memory use does not depend
+ * on the requested window.
+ * With maxPoints set and more records in range, the records pass through a
+ * streaming LTTB (lttb.h): at most maxPoints points (unless the heater
+ * edges alone need more), first and last record always included, every
+ * heater on/off edge at its exact timestamp.
+ * Raw-tier responses carry X-History-Cursor (one past the last sample in
+ * range); the client passes it back as afterSeq to fetch only what is new.
+ * It is left out while the live stand-in sample is sent, so that sample is
+ * never cached.
+ ******************************************************************************/
+static void streamHistory(HttpConn& c, const HistoryFormat& fmt)
+{
+  HistoryJob* j = new (std::nothrow) HistoryJob;
+  if (j == nullptr)
+  {
+    httpSend(c, 503, "text/plain", "Out of memory");
+    return;
+  }
 
-    function buildPath(vals)
-    {
-      var d = '';
-      for (var i = 0; i < vals.length; i++)
-      {
-        var x = xForTs(tsList[i]);
-        var y = yFor(vals[i]);
-        if (i == 0)
-        {
-          d += 'M' + x + ' ' + y;
-        }
-        else
-        {
-          d += ' L' + x + ' ' + y;
-        }
-      }
-      return d;
-    }
+  j->conn        = &c;
+  j->fmt         = &fmt;
+  j->written     = 0;
+  j->minFreeHeap = ESP.getFreeHeap();
+  openHistoryQuery(c, j->q);
+  j->haveLive = (j->q.count == 0) && (j->q.tier == TIER_RAW) && !j->q.incremental && makeLiveSample(j->live);
+
+  httpAddHeader(c, "X-History-Tier", String((int)j->q.tier));
+  if (j->q.tier == TIER_RAW && !j->haveLive)
+  {
+    httpAddHeader(c, "X-History-Cursor", String(j->q.cursor.endSeq));
+  }
+  httpStream(c, 200, fmt.contentType, produceHistory, j, releaseHistoryJob);
+}
+
+/***************** handleHistoryJson ********************************************
+ * params: c
+ * return: void
+ * Description:
+ * Streams history data as compact JSON for chart/table rendering.
+ ******************************************************************************/
+static void handleHistoryJson(HttpConn& c)
+{
+  streamHistory(c, FMT_JSON);
+}
 
-    function buildSmoothPath(vals)
+/***************** handleHistoryBin *********************************************
+ * params: c
+ * return: void
+ * Description:
+ * Streams history data in the delta/varint format (~2 bytes per sample
+ * instead of ~48 for JSON). Decoded by decodeHistoryBin() in web/app.js.
+ ******************************************************************************/
+static void handleHistoryBin(HttpConn& c)
+{
+  streamHistory(c, FMT_BIN);
+}
+
+/***************** handleHistoryCsv *********************************************
+ * params: c
+ * return: void
+ * Description:
+ * Streams history as CSV for spreadsheets and scripts (columns see
+ * writeCsvCommon()). Same parameters as /history.json; for long ranges use
+ * from/to or tier=hour|day. Rows go out one buffer per server pass, so even
+ * a full-ring export keeps each pass short.
+ ******************************************************************************/
+static void handleHistoryCsv(HttpConn& c)
+{
+  httpAddHeader(c, "Content-Disposition", "attachment; filename=\"history.csv\"");
+  streamHistory(c, FMT_CSV);
+}
+
+/***************** writePhaseJson ***********************************************
+ * params: w, on, off, index
+ * return: void
+ * Description:
+ * Appends one heating phase. off == nullptr: phase still running, or its
+ * OFF edge was lost (power cut while heating) or has another time base.
+ ******************************************************************************/
+static void writePhaseJson(HttpConn& w, const HeaterEvent& on, const HeaterEvent* off, size_t index)
+{
+  char rec[176];
+  int n = snprintf(rec, sizeof(rec), "%s{\"on\":%lu,\"tOn\":%d,\"sp\":%d,\"hy\":%d,\"cOn\":\"%s\"",
+                   index == 0 ? "" : ",", (unsigned long)on.tsSec, (int)on.tempCenti,
+                   (int)on.setPointCenti, (int)on.hysteresisCenti,
+                   causeToStr((HeaterCause)on.cause));
+  if (n > 0 && (size_t)n < sizeof(rec))
+  {
+    if (off != nullptr)
     {
-      if (!vals.length)
-      {
-        return '';
-      }
-      var pts = [];
-      for (var i = 0; i < vals.length; i++)
+      // Sensorfehler-Flanken haben keine Temperatur (INT16_MIN)
+      char tOff[8] = "null";
+      if (off->tempCenti != INT16_MIN)
       {
-        pts.push({ x: xForTs(tsList[i]), y: yFor(vals[i]) });
+        snprintf(tOff, sizeof(tOff), "%d", (int)off->tempCenti);
       }
-      var d = 'M' + pts[0].x + ' ' + pts[0].y;
-      for (var j = 0; j < pts.length - 1; j++)
-      {
-        var p0 = j > 0 ? pts[j - 1] : pts[j];
-        var p1 = pts[j];
-        var p2 = pts[j + 1];
-        var p3 = (j + 2 < pts.length) ? pts[j + 2] : p2;
-        var cp1x = p1.x + (p2.x - p0.x) / 6;
-        var cp1y = p1.y + (p2.y - p0.y) / 6;
-        var cp2x = p2.x - (p3.x - p1.x) / 6;
-        var cp2y = p2.y - (p3.y - p1.y) / 6;
-        d += ' C ' + cp1x + ' ' + cp1y + ' ' + cp2x + ' ' + cp2y + ' ' + p2.x + ' ' + p2.y;
-      }
-      return d;
+      n += snprintf(rec + n, sizeof(rec) - n, ",\"off\":%lu,\"tOff\":%s,\"cOff\":\"%s\"}",
+                    (unsigned long)off->tsSec, tOff, causeToStr((HeaterCause)off->cause));
     }
-
-    var pathGlow = document.createElementNS('http://www.w3.org/2000/svg', 'path');
-    pathGlow.setAttribute('d', buildSmoothPath(temps));
-    pathGlow.setAttribute('class', 'temp-glow');
-    svg.appendChild(pathGlow);
-
-    var pathTemp = document.createElementNS('http://www.w3.org/2000/svg', 'path');
-    pathTemp.setAttribute('d', buildSmoothPath(temps));
-    pathTemp.setAttribute('class', 'temp-line');
-    svg.appendChild(pathTemp);
-
-    var pathUpper = document.createElementNS('http://www.w3.org/2000/svg', 'path');
-    pathUpper.setAttribute('d', buildPath(uppers));
-    pathUpper.setAttribute('class', 'upper-line');
-    svg.appendChild(pathUpper);
-
-    var pathLower = document.createElementNS('http://www.w3.org/2000/svg', 'path');
-    pathLower.setAttribute('d', buildPath(lowers));
-    pathLower.setAttribute('class', 'lower-line');
-    svg.appendChild(pathLower);
-
-    var yLbl = document.createElementNS('http://www.w3.org/2000/svg', 'text');
-    yLbl.setAttribute('x', 15);
-    yLbl.setAttribute('y', padT + 10);
-    yLbl.setAttribute('class', 'axis-label');
-    yLbl.textContent = '°C';
-    svg.appendChild(yLbl);
-
-    var hoverLine = document.createElementNS('http://www.w3.org/2000/svg', 'line');
-    hoverLine.setAttribute('class', 'hover-line');
-    hoverLine.style.display = 'none';
-    svg.appendChild(hoverLine);
-
-    var hoverDot = document.createElementNS('http://www.w3.org/2000/svg', 'circle');
-    hoverDot.setAttribute('r', '3');
-    hoverDot.setAttribute('class', 'hover-dot');
-    hoverDot.style.display = 'none';
-    svg.appendChild(hoverDot);
-
-    var hoverText = document.createElementNS('http://www.w3.org/2000/svg', 'text');
-    hoverText.setAttribute('x', padL + 5);
-    hoverText.setAttribute('y', padT + 15);
-    hoverText.setAttribute('class', 'hover-text');
-    hoverText.style.display = 'none';
-    svg.appendChild(hoverText);
-
-    var overlay = document.createElementNS('http://www.w3.org/2000/svg', 'rect');
-    overlay.setAttribute('x', padL);
-    overlay.setAttribute('y', padT);
-    overlay.setAttribute('width', width - padL - padR);
-    overlay.setAttribute('height', height - padT - padB);
-    overlay.setAttribute('fill', 'transparent');
-    overlay.style.cursor = 'crosshair';
-    svg.appendChild(overlay);
-
-    function hideHover()
+    else
     {
-      hoverLine.style.display = 'none';
-      hoverDot.style.display = 'none';
-      hoverText.style.display = 'none';
+      n += snprintf(rec + n, sizeof(rec) - n, ",\"off\":null}");
     }
+  }
+  if (n > 0 && (size_t)n < sizeof(rec))
+  {
+    httpWrite(w, rec, (size_t)n);
+  }
+}
 
-    function showHover(evt)
-    {
-      var pt = svg.createSVGPoint();
-      pt.x = evt.clientX;
-      pt.y = evt.clientY;
-      var sp = pt.matrixTransform(svg.getScreenCTM().inverse());
-      var x = sp.x;
+/***************** PhaseJob *****************************************************
+ * Description:
+ * State of one /phases.json response between producer steps. An ON event
+ * waits in `pending` until its OFF event arrives.
+ ******************************************************************************/
+struct PhaseJob
+{
+  HistoryCursor cursor;
+  HeaterEvent   pending;
+  bool          havePending;
+  size_t        phases;
+};
 
-      if (x < padL || x > (width - padR))
-      {
-        hideHover();
-        return;
-      }
+static const size_t PHASE_BATCH = 4;   // Events pro Lesezugriff
+static const size_t PHASE_JSON_MAX = 176;
 
-      var f = (x - padL) / (width - padL - padR);
-      if (f < 0) { f = 0; }
-      if (f > 1) { f = 1; }
+static void releasePhaseJob(void* ctx)
+{
+  delete (PhaseJob*)ctx;
+}
 
-      var targetTs = minTs + f * tsSpan;
-      var idx = 0;
-      var bestDiff = Math.abs(tsList[0] - targetTs);
-      for (var ii = 1; ii < tsList.length; ii++)
+/***************** phasePairable ************************************************
+ * params: on, off
+ * return: bool
+ * Description:
+ * True if off can close the phase opened by on: both stamped in the same
+ * time base (epoch or uptime) and not before it.
+ ******************************************************************************/
+static bool phasePairable(const HeaterEvent& on, const HeaterEvent& off)
+{
+  const bool onEpoch  = on.tsSec >= CSV_EPOCH_MIN;
+  const bool offEpoch = off.tsSec >= CSV_EPOCH_MIN;
+  return onEpoch == offEpoch && off.tsSec >= on.tsSec;
+}
+
+/***************** producePhases ************************************************
+ * params: c
+ * return: bool
+ * Description:
+ * Pairs ON/OFF events into phases until the chunk is about full.
+ ******************************************************************************/
+static bool producePhases(HttpConn& c)
+{
+  PhaseJob& j = *(PhaseJob*)c.ctx;
+  if (c.step == 0)
+  {
+    httpPrint(c, "[");
+    c.step = 1;
+  }
+
+  HeaterEvent evs[PHASE_BATCH];
+  size_t r = 1;
+  while (httpTxFree(c) >= PHASE_BATCH * PHASE_JSON_MAX &&
+         (r = readPhaseCursor(j.cursor, evs, PHASE_BATCH)) > 0)
+  {
+    for (size_t i = 0; i < r; i++)
+    {
+      if (evs[i].on)
       {
-        var diff = Math.abs(tsList[ii] - targetTs);
-        if (diff < bestDiff)
+        if (j.havePending)
         {
-          bestDiff = diff;
-          idx = ii;
+          writePhaseJson(c, j.pending, nullptr, j.phases++); // AUS-Flanke verloren
         }
+        j.pending = evs[i];
+        j.havePending = true;
+      }
+      else if (j.havePending)
+      {
+        // über eine Zeitbasis-Grenze (Reboot vor NTP) hinweg nicht paaren
+        writePhaseJson(c, j.pending, phasePairable(j.pending, evs[i]) ? &evs[i] : nullptr, j.phases++);
+        j.havePending = false;
       }
-
-      var xv = xForTs(tsList[idx]);
-      var yv = yFor(temps[idx]);
-
-      hoverLine.setAttribute('x1', xv);
-      hoverLine.setAttribute('y1', padT);
-      hoverLine.setAttribute('x2', xv);
-      hoverLine.setAttribute('y2', height - padB);
-      hoverLine.style.display = 'block';
-
-      hoverDot.setAttribute('cx', xv);
-      hoverDot.setAttribute('cy', yv);
-      hoverDot.style.display = 'block';
-
-      var txt = formatTs(tsList[idx]) + "  " + formatTemp(temps[idx]);
-      hoverText.textContent = txt;
-      hoverText.style.display = 'block';
     }
-
-    overlay.addEventListener('mousemove', showHover);
-    overlay.addEventListener('mouseleave', hideHover);
+  }
+  if (r > 0)
+  {
+    return true;
   }
 
-  fetchHistory()
-    .then(function(data){
-      var history = normalizeHistory(data || []);
-      renderTable(history);
-      renderChart(history);
-    })
-    .catch(function(){
-      tableWrap.innerHTML = "<div class='muted'>Verlauf konnte nicht geladen werden</div>";
-      clearSvg();
-      drawText(20, 40, "Verlauf konnte nicht geladen werden", "");
-    });
-
-})();
-)JS";
+  if (j.havePending)
+  {
+    writePhaseJson(c, j.pending, nullptr, j.phases++);
+  }
+  httpPrint(c, "]");
+  Serial.printf("[WEB] /phases.json phases=%u\n", (unsigned)j.phases);
+  return false;
+}
 
-static void renderIndex()
+/***************** handlePhasesJson *********************************************
+ * params: c
+ * return: void
+ * Description:
+ * Streams heating phases paired from the heater edge log. Window like the
+ * history endpoints: from/to (epoch seconds) or days (1..90, default 1).
+ * Phases are exact to the second, independent of LOG_INTERVAL_MINUTES.
+ ******************************************************************************/
+static void handlePhasesJson(HttpConn& c)
 {
-  const float t = getLastTemperature();
-  const bool heaterIsOn = isHeaterOn();
-
-  webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  webServer.send(200, "text/html; charset=utf-8", "");
-  webServer.sendContent_P(pageHeadStart);
-  webServer.sendContent(getBaseTopic());
-  webServer.sendContent_P(pageHeadEnd);
-
-  // Header card
-  webServer.sendContent_P(PSTR("<div class='card'><div class='status-row'><div><h2>Heizungssteuerung</h2><div class='muted small'>Raum: "));
-  webServer.sendContent(getBaseTopic());
-  webServer.sendContent_P(PSTR(" &middot; Version: "));
-  webServer.sendContent(APP_VERSION);
-  webServer.sendContent_P(PSTR(" &middot; Lokal: http://"));
-  webServer.sendContent(getHostLabel());
-  webServer.sendContent_P(PSTR(".local &middot; IP: "));
-  if (WiFi.isConnected())
+  uint32_t fromTs = 0;
+  uint32_t toTs   = UINT32_MAX;
+  if (httpHasArg(c, "from") || httpHasArg(c, "to"))
   {
-    webServer.sendContent(WiFi.localIP().toString());
+    fromTs = parseEpochArg(c, "from", 0);
+    toTs   = parseEpochArg(c, "to", UINT32_MAX);
   }
-  else
+  else if (isTimeSynced())
   {
-    webServer.sendContent_P(PSTR("offline"));
+    const int days = clampInt(httpHasArg(c, "days") ? httpArg(c, "days").toInt() : 1, 1, 90);
+    fromTs = getEpochNow() - (uint32_t)days * 86400UL;
   }
-  webServer.sendContent_P(PSTR("</div></div>"));
-
-  webServer.sendContent_P(PSTR("<div class='status-item "));
-  webServer.sendContent(heaterIsOn ? "status-ok" : "status-bad");
-  webServer.sendContent_P(PSTR("'>🔥 "));
-  webServer.sendContent(heaterIsOn ? "Heizung EIN" : "Heizung AUS");
-  webServer.sendContent_P(PSTR("</div>"));
 
-  if (heaterIsOn)
+  PhaseJob* j = new (std::nothrow) PhaseJob;
+  if (j == nullptr)
   {
-    webServer.sendContent_P(PSTR("<button class='btn' type='button' onclick=\"if(confirm('Heizung wirklich ausschalten?')){postAction('/heaterOff');}\">🛑 Heizung ausschalten</button>"));
+    httpSend(c, 503, "text/plain", "Out of memory");
+    return;
   }
+  j->havePending = false;
+  j->phases      = 0;
+  openPhaseRange(j->cursor, fromTs, toTs);
 
-  // MQTT + time status
-  webServer.sendContent_P(PSTR("<div class='status-item "));
-  webServer.sendContent(mqttIsConnected() ? "status-ok" : "status-bad");
-  webServer.sendContent_P(PSTR("'>MQTT "));
-  webServer.sendContent(mqttIsConnected() ? "Verbunden" : "Getrennt");
-  webServer.sendContent_P(PSTR("</div>"));
-
-  webServer.sendContent_P(PSTR("<div class='status-item'>Temperatur: <b>"));
-  webServer.sendContent(String(t, 1));
-  webServer.sendContent_P(PSTR("&deg;C</b></div></div></div>"));
-
-  // Config card: schedule + setpoints
-  webServer.sendContent_P(PSTR("<div class='card'><h3>Zeitplan</h3><div class='split'>"));
-
-  // Tagesbereich
-  webServer.sendContent_P(PSTR("<div class='card'><h3>Tag</h3><div class='grid'><label>Soll (°C)</label>"
-                              "<input name='daySetPoint' type='number' step='0.5' min='5' max='35' value='"));
-  webServer.sendContent(String(getDaySetPoint(), 1));
-  webServer.sendContent_P(PSTR("'>"
-                              "<button class='btn' type='button' onclick=\"nudge('daySetPoint',-0.5)\">-</button>"
-                              "<button class='btn' type='button' onclick=\"nudge('daySetPoint',0.5)\">+</button></div>"
-                              "<div class='grid'><label>Beginn</label>"
-                              "<input name='dayStart' type='time' step='300' value='"));
-  webServer.sendContent(fmtTime(getDayStartMinutes()));
-  webServer.sendContent_P(PSTR("'>"
-                              "<span></span><span></span></div></div>"));
-
-  // Nachtbereich
-  webServer.sendContent_P(PSTR("<div class='card'><h3>Nacht</h3><div class='grid'><label>Soll (°C)</label>"
-                              "<input name='nightSetPoint' type='number' step='0.1' min='5' max='35' value='"));
-  webServer.sendContent(String(getNightSetPoint(), 1));
-  webServer.sendContent_P(PSTR("'>"
-                              "<button class='btn' type='button' onclick=\"nudge('nightSetPoint',-0.5)\">-</button>"
-                              "<button class='btn' type='button' onclick=\"nudge('nightSetPoint',0.5)\">+</button></div>"
-                              "<div class='grid'><label>Beginn</label>"
-                              "<input name='nightStart' type='time' step='300' value='"));
-  webServer.sendContent(fmtTime(getNightStartMinutes()));
-  webServer.sendContent_P(PSTR("'>"
-                              "<span></span><span></span></div></div>"));
-
-  webServer.sendContent_P(PSTR("</div><div class='hr'></div>"));
-
-  // Hysteresis
-  webServer.sendContent_P(PSTR("<div class='grid'><label>Hysterese (°C)</label>"
-                              "<input name='hysteresis' type='number' step='0.1' min='0.1' max='5.0' value='"));
-  webServer.sendContent(String(getHysteresis(), 1));
-  webServer.sendContent_P(PSTR("'>"
-                              "<button class='btn' type='button' onclick=\"nudge('hysteresis',-0.1)\">-</button>"
-                              "<button class='btn' type='button' onclick=\"nudge('hysteresis',0.1)\">+</button></div>"
-                              "<div class='muted small'>Einschalttemperatur: <b>"));
-  webServer.sendContent(String(getSetPoint(), 1));
-  webServer.sendContent_P(PSTR(" &deg;C</b> (Soll - Hysterese)</div>"));
+  httpStream(c, 200, "application/json", producePhases, j, releasePhaseJob);
+}
 
-  // Boost minutes
-  webServer.sendContent_P(PSTR("<div class='grid'><label>Boost (min)</label>"
-                              "<input name='boostMinutes' type='number' step='1' min='0' max='240' value='"));
-  webServer.sendContent(String(getBoostMinutes()));
-  webServer.sendContent_P(PSTR("'>"
-                              "<button class='btn' type='button' onclick=\"nudge('boostMinutes',-5)\">-</button>"
-                              "<button class='btn' type='button' onclick=\"nudge('boostMinutes',5)\">+</button></div>"));
-
-  // Boost control
-  if (getControlMode() == MODE_BOOST)
-  {
-    unsigned long now = millis();
-    unsigned long end = getBoostEndTime();
-    if (end > now)
-    {
-      float remaining = (end - now) / 60000.0f;
-      webServer.sendContent_P(PSTR("<p>Boost aktiv ~ "));
-      webServer.sendContent(String((int)remaining));
-      webServer.sendContent_P(PSTR(" min verbleibend</p>"));
-    }
+/***************** formatDeci ***************************************************
+ * params: buf, size, deci
+ * return: const char*
+ * Description:
+ * Formats a tenths value as JSON number ("21.5", "-0.5"); INT16_MIN -> null.
+ ******************************************************************************/
+static const char* formatDeci(char* buf, size_t size, int16_t deci)
+{
+  if (deci == INT16_MIN)
+  {
+    return "null";
   }
+  const int a = deci < 0 ? -deci : deci;
+  snprintf(buf, size, "%s%d.%d", deci < 0 ? "-" : "", a / 10, a % 10);
+  return buf;
+}
 
-  webServer.sendContent_P(PSTR("<div><div class='grid'><label>Boost</label>"
-                              "<button class='btn' type='button' onclick=\"postAction('/boost')\">Starten</button>"
-                              "<span></span><span></span></div></div></div>"));
-
-  // History card
-  webServer.sendContent_P(PSTR("<div class='card'><div class='status-row'><h3>Verlauf</h3>"
-                              "<div class='viewBtns'><a href='/history.json?days=1'>"
-                              "<button class='btn' type='button'>Verlauf (1 Tag)</button></a>"
-                              "<button class='btn' type='button' data-view='chart'>Diagramm</button>"
-                              "<button class='btn' type='button' data-view='table'>Tabelle</button>"
-                              "</div></div>"
-                              "<div id='histChartWrap'>"
-                              "<svg id='histSvg' viewBox='0 0 600 320' preserveAspectRatio='xMidYMid meet' style='width:100%;height:auto;border:1px solid var(--border);border-radius:.75rem;'></svg>"
-                              "</div>"
-                              "<div id='histTableWrap' style='display:none;'></div>"
-                              "</div>"));
+/***************** formatStatusJson *********************************************
+ * params: buf, size
+ * return: void
+ * Description:
+ * Current status snapshot (status.h) as compact JSON, shared by /api/status
+ * and the "status" event.
+ ******************************************************************************/
+static void formatStatusJson(char* buf, size_t size)
+{
+  const StatusSnapshot& s = getStatus();
+  char t[8], sp[8], h[6];
+  if (s.humPct < 0)
+  {
+    strcpy(h, "null");
+  }
+  else
+  {
+    snprintf(h, sizeof(h), "%d", s.humPct);
+  }
 
-  // JS
-  webServer.sendContent_P(PSTR("<script>const schedCfg={dayStart:"));
-  webServer.sendContent(String(getDayStartMinutes()));
-  webServer.sendContent_P(PSTR(",nightStart:"));
-  webServer.sendContent(String(getNightStartMinutes()));
-  webServer.sendContent_P(PSTR(",daySet:"));
-  webServer.sendContent(String(getDaySetPoint(), 1));
-  webServer.sendContent_P(PSTR(",nightSet:"));
-  webServer.sendContent(String(getNightSetPoint(), 1));
-  webServer.sendContent_P(PSTR("};\n"));
-  webServer.sendContent_P(pageScript);
-  webServer.sendContent_P(PSTR("</script>"));
-
-  webServer.sendContent_P(pageTail);
+  snprintf(buf, size,
+           "{\"v\":%lu,\"t\":%s,\"h\":%s,\"heater\":%s,\"mode\":\"%s\",\"state\":\"%s\","
+           "\"sp\":%s,\"boostMin\":%u,\"mqtt\":%s,\"ntp\":%s}",
+           (unsigned long)getStatusVersion(),
+           formatDeci(t, sizeof(t), s.tempDeci), h,
+           s.heater ? "true" : "false",
+           modeToStr((ControlMode)s.mode), stateToStr((ControlState)s.state),
+           formatDeci(sp, sizeof(sp), s.setPointDeci), (unsigned)s.boostMin,
+           s.mqtt ? "true" : "false", s.timeSync ? "true" : "false");
 }
 
-/***************** handleConfigPost ********************************************
- * params: none
+/***************** formatConfigJson *********************************************
+ * params: buf, size
  * return: void
  * Description:
- * Applies config changes posted from the HTML page.
+ * Persistent config as JSON, same keys as the MQTT state message
+ * (dayStart/nightStart in minutes since midnight).
  ******************************************************************************/
-static void handleConfigPost()
+static void formatConfigJson(char* buf, size_t size)
 {
-  // (Original content kept as-is)
-  // ...
-  renderIndex();
+  snprintf(buf, size,
+           "{\"cv\":%lu,\"setPoint\":%.1f,\"daySetPoint\":%.1f,\"nightSetPoint\":%.1f,"
+           "\"dayStart\":%d,\"nightStart\":%d,\"hysteresis\":%.1f,\"boostMinutes\":%d,\"aggReadings\":%d}",
+           (unsigned long)getConfigVersion(), getSetPoint(), getDaySetPoint(), getNightSetPoint(),
+           getDayStartMinutes(), getNightStartMinutes(), getHysteresis(), getBoostMinutes(),
+           getAggReadings());
 }
 
-  /***************** handleHistoryJson ********************************************
- * params: none
+/***************** handleStatusJson *********************************************
+ * params: c
  * return: void
  * Description:
- * Returns history data in compact JSON for chart/table rendering.
+ * Compact live snapshot for polling clients. The ETag changes only when a
+ * field changes (see status.h), so a poll with If-None-Match is usually a
+ * header-only 304.
  ******************************************************************************/
-static void handleHistoryJson()
+static void handleStatusJson(HttpConn& c)
 {
-  const int daysParam = webServer.hasArg("days") ? webServer.arg("days").toInt() : 5;
-  const int days = clampInt(daysParam, 1, 14);
-
-  if (LOG_INTERVAL_MINUTES <= 0)
+  handleStatus();
+  const String etag = getStatusEtag();
+  httpAddHeader(c, "ETag", etag);
+  httpAddHeader(c, "Cache-Control", "no-cache");
+  if (httpHeader(c, "If-None-Match") == etag)
   {
-    webServer.send(200, "application/json", "[]");
+    httpSend(c, 304, nullptr, "");
     return;
   }
 
-  const unsigned long intervalMin  = (unsigned long)LOG_INTERVAL_MINUTES;
-  const unsigned long totalMinutes = (unsigned long)days * 24UL * 60UL;
+  char body[224];
+  formatStatusJson(body, sizeof(body));
+  httpSend(c, 200, "application/json", body);
+}
+
+/***************** Server-Sent Events *******************************************
+ * Description:
+ * /events keeps the response open and pushes
+ *   event: status  (formatStatusJson) whenever the status version moves,
+ *   event: config  (formatConfigJson) whenever a setter saved the config,
+ * plus a comment line every EVENTS_KEEPALIVE_MS so that neither httpd nor
+ * a proxy drops the idle connection. Both versions are updated right after
+ * handleSensor()/handleControl() in loop() and by every config setter, so
+ * a change reaches the page within one loop pass. The producer is polled
+ * once per server pass and only compares two counters while idle.
+ ******************************************************************************/
+struct EventsJob
+{
+  uint32_t      statusV;
+  uint32_t      configV;
+  unsigned long lastSendMs;
+};
 
-  size_t maxRecords = (totalMinutes + intervalMin - 1UL) / intervalMin;
-  if (maxRecords > HISTORY_CAPACITY_RECORDS)
+static uint8_t eventClients = 0;
+
+static void releaseEventsJob(void* ctx)
+{
+  delete (EventsJob*)ctx;
+  eventClients--;
+}
+
+static bool produceEvents(HttpConn& c)
+{
+  EventsJob* j = (EventsJob*)c.ctx;
+  char buf[288];
+  const unsigned long now = millis();
+
+  if (c.step == 0)
   {
-    maxRecords = HISTORY_CAPACITY_RECORDS;
+    c.step = 1;
+    httpPrint_P(c, PSTR("retry: 3000\n\n"));
   }
+  if (j->statusV != getStatusVersion())
+  {
+    j->statusV = getStatusVersion();
+    formatStatusJson(buf, sizeof(buf));
+    httpPrint_P(c, PSTR("event: status\ndata: "));
+    httpPrint(c, buf);
+    httpPrint_P(c, PSTR("\n\n"));
+    j->lastSendMs = now;
+  }
+  if (j->configV != getConfigVersion())
+  {
+    j->configV = getConfigVersion();
+    formatConfigJson(buf, sizeof(buf));
+    httpPrint_P(c, PSTR("event: config\ndata: "));
+    httpPrint(c, buf);
+    httpPrint_P(c, PSTR("\n\n"));
+    j->lastSendMs = now;
+  }
+  if (now - j->lastSendMs >= EVENTS_KEEPALIVE_MS)
+  {
+    httpPrint_P(c, PSTR(":\n\n"));
+    j->lastSendMs = now;
+  }
+  return true;
+}
 
-  if (maxRecords == 0)
+/***************** handleEvents *************************************************
+ * params: c
+ * return: void
+ * Description:
+ * Opens an event stream. The first pass sends the full status and config
+ * (versions start at 0), so a (re)connecting page is always in sync.
+ * At most EVENTS_MAX_CLIENTS streams, so normal requests keep a slot.
+ ******************************************************************************/
+static void handleEvents(HttpConn& c)
+{
+  if (eventClients >= EVENTS_MAX_CLIENTS)
   {
-    webServer.send(200, "application/json", "[]");
+    httpAddHeader(c, "Retry-After", "10");
+    httpSend(c, 503, "text/plain", "Too many event streams");
     return;
   }
-
-  LogSample* buffer = (LogSample*)malloc(sizeof(LogSample) * maxRecords);
-  if (buffer == nullptr)
+  EventsJob* j = new (std::nothrow) EventsJob;
+  if (j == nullptr)
   {
-    webServer.send(500, "application/json", "[]");
+    httpSend(c, 503, "text/plain", "Out of memory");
     return;
   }
+  j->statusV    = 0;
+  j->configV    = (uint32_t)-1;
+  j->lastSendMs = millis();
+  eventClients++;
+
+  handleStatus();
+  httpAddHeader(c, "Cache-Control", "no-cache");
+  httpStream(c, 200, "text/event-stream", produceEvents, j, releaseEventsJob);
+}
+
+/***************** Config API ***************************************************
+ * Description:
+ * /api/config and /config take any subset of the config fields, validate
+ * all of them and apply them with one EEPROM commit (applyConfigPatch()).
+ * One bad field rejects the whole request.
+ ******************************************************************************/
+static const char* const configKeys[] =
+{
+  "setPoint", "daySetPoint", "nightSetPoint", "dayStart", "nightStart", "hysteresis", "boostMinutes",
+  "aggReadings"
+};
 
-  size_t count = 0;
-  readHistoryTail(maxRecords, buffer, &count);
+/***************** patchFromText ************************************************
+ * params: p, key, text
+ * return: ConfigPatchResult
+ * Description:
+ * Form/JSON string value: a number, or HH:MM for dayStart/nightStart.
+ ******************************************************************************/
+static ConfigPatchResult patchFromText(ConfigPatch& p, const char* key, const char* text)
+{
+  if (strchr(text, ':') != nullptr && (strcmp(key, "dayStart") == 0 || strcmp(key, "nightStart") == 0))
+  {
+    return configPatchSet(p, key, (float)parseTimeMinutes(String(text)));
+  }
+  char* end = nullptr;
+  const float v = strtof(text, &end);
+  if (end == text || *end != '\0')
+  {
+    return CFG_PATCH_RANGE;
+  }
+  return configPatchSet(p, key, v);
+}
 
-  /* fallback: no history yet → inject live sample */
-  if (count == 0)
+/***************** parseConfigRequest *******************************************
+ * params: c, p, badKey (out)
+ * return: ConfigPatchResult
+ * Description:
+ * Fills the patch from a JSON object body or from form/query arguments.
+ * On error, badKey names the offending field.
+ ******************************************************************************/
+static ConfigPatchResult parseConfigRequest(const HttpConn& c, ConfigPatch& p, String& badKey)
+{
+  if (httpHeader(c, "Content-Type").startsWith("application/json"))
   {
-    const float currentTemp = getLastTemperature();
-    if (!isnan(currentTemp))
+    size_t len = 0;
+    const char* body = httpBody(c, len);
+    StaticJsonDocument<384> doc;
+    if (deserializeJson(doc, body, len))
     {
-      LogSample live;
-      live.tsSec           = getEpochOrUptimeSec();
-      live.tempCenti       = (int16_t)roundf(currentTemp * 100.0f);
-      live.setPointCenti   = (int16_t)roundf(getSetPoint() * 100.0f);
-      live.hysteresisCenti = (int16_t)roundf(getHysteresis() * 100.0f);
-      live.flags           = isHeaterOn() ? 0x01 : 0x00;
-      live.rsv             = 0;
-
-      buffer[0] = live;
-      count     = 1;
+      badKey = "(json)";
+      return CFG_PATCH_RANGE;
     }
-    else
+    for (JsonPair kv : doc.as<JsonObject>())
     {
-      free(buffer);
-      webServer.send(200, "application/json", "[]");
-      return;
+      const char* key = kv.key().c_str();
+      ConfigPatchResult r;
+      if (kv.value().is<const char*>())
+      {
+        r = patchFromText(p, key, kv.value().as<const char*>());
+      }
+      else if (kv.value().is<float>())
+      {
+        r = configPatchSet(p, key, kv.value().as<float>());
+      }
+      else
+      {
+        r = CFG_PATCH_RANGE;
+      }
+      if (r != CFG_PATCH_OK)
+      {
+        badKey = key;
+        return r;
+      }
     }
+    return CFG_PATCH_OK;
   }
 
-  String json;
-  json.reserve(count * 48 + 16);
-  json += '[';
-
-  for (size_t i = 0; i < count; i++)
+  for (const char* key : configKeys)
   {
-    if (i > 0)
+    if (!httpHasArg(c, key))
     {
-      json += ',';
+      continue;
     }
+    const ConfigPatchResult r = patchFromText(p, key, httpArg(c, key).c_str());
+    if (r != CFG_PATCH_OK)
+    {
+      badKey = key;
+      return r;
+    }
+  }
+  return CFG_PATCH_OK;
+}
 
-    const LogSample& s = buffer[i];
-
-    json += '{';
-    json += F("\"ts\":");
-    json += s.tsSec;
-    json += F(",\"t\":");
-    json += s.tempCenti;
-    json += F(",\"sp\":");
-    json += s.setPointCenti;
-    json += F(",\"hy\":");
-    json += s.hysteresisCenti;
-    json += F(",\"h\":");
-    json += (s.flags & 0x01) ? '1' : '0';
-    json += '}';
+/***************** handleConfigApi **********************************************
+ * params: c
+ * return: void
+ * Description:
+ * POST /api/config: JSON object or form fields. Answers with the resulting
+ * config as JSON (same as the "config" event), or 400 naming the bad field.
+ ******************************************************************************/
+static void handleConfigApi(HttpConn& c)
+{
+  ConfigPatch p;
+  String badKey;
+  const ConfigPatchResult r = parseConfigRequest(c, p, badKey);
+  if (r != CFG_PATCH_OK)
+  {
+    char err[96];
+    snprintf(err, sizeof(err), "{\"error\":\"%s\",\"field\":\"%s\"}",
+             r == CFG_PATCH_UNKNOWN ? "unknown field" : "invalid value", badKey.c_str());
+    httpSend(c, 400, "application/json", err);
+    return;
   }
 
-  json += ']';
+  applyConfigPatch(p);
+  char body[224];
+  formatConfigJson(body, sizeof(body));
+  httpSend(c, 200, "application/json", body);
+}
 
-  free(buffer);
-  webServer.send(200, "application/json", json);
+/***************** handleConfigPost ********************************************
+ * params: c
+ * return: void
+ * Description:
+ * Applies config changes posted from an HTML form (PRG back to "/").
+ ******************************************************************************/
+static void handleConfigPost(HttpConn& c)
+{
+  ConfigPatch p;
+  String badKey;
+  if (parseConfigRequest(c, p, badKey) != CFG_PATCH_OK)
+  {
+    httpSend(c, 400, "text/plain", "Invalid config value");
+    return;
+  }
+  applyConfigPatch(p);
+  redirectToRoot(c);
+}
+
+/***************** handleMetrics ************************************************
+ * params: c
+ * return: void
+ * Description:
+ * Prometheus scrape target, see metrics.h.
+ ******************************************************************************/
+static void handleMetrics(HttpConn& c)
+{
+  httpAddHeader(c, "Cache-Control", "no-store");
+  httpStream(c, 200, "text/plain; version=0.0.4", produceMetrics, nullptr, nullptr);
 }
 
 /***************** handleHeaterOffPost *****************************************
- * params: none
+ * params: c
  * return: void
  * Description:
  * Immediately turns heater OFF, used as safety button in UI.
  ******************************************************************************/
-static void handleHeaterOffPost()
+static void handleHeaterOffPost(HttpConn& c)
 {
   requestHeaterOffNow();
-  redirectToRoot();
+  redirectToRoot(c);
 }
 
 /***************** handleBoostPost **********************************************
- * params: none
+ * params: c
  * return: void
  * Description:
  * Starts BOOST using configured duration and persists end timestamp.
  ******************************************************************************/
-static void handleBoostPost()
+static void handleBoostPost(HttpConn& c)
 {
   unsigned long now = millis();
   unsigned long end = now + (unsigned long)getBoostMinutes() * 60000UL;
   setBoostEndTime(end);
   setControlMode(MODE_BOOST);
-  redirectToRoot();
+  redirectToRoot(c);
 }
 
 /***************** handleNudgePost *********************************************
- * params: none
+ * params: c
  * return: void
  * Description:
  * Small +/- adjustments via POST body params (field, delta). Redirects to "/"
  * to avoid double execution on page refresh.
  ******************************************************************************/
-static void handleNudgePost()
+static void handleNudgePost(HttpConn& c)
 {
-  String field = webServer.arg("field");
-  float delta  = webServer.arg("delta").toFloat();
+  String field = httpArg(c, "field");
+  float delta  = httpArg(c, "delta").toFloat();
 
   if (field == "setPoint")
   {
@@ -1121,20 +1516,46 @@ static void handleNudgePost()
     setBoostMinutes(getBoostMinutes() + (int)delta);
   }
 
-  redirectToRoot();
+  redirectToRoot(c);
 }
 
 /***************** handleNudgeGet **********************************************
- * params: none
+ * params: c
  * return: void
  * Description:
  * Rejects GET on /nudge to ensure actions cannot be triggered by URL refresh.
  ******************************************************************************/
-static void handleNudgeGet()
+static void handleNudgeGet(HttpConn& c)
 {
-  webServer.send(405, "text/plain", "Method Not Allowed");
+  httpSend(c, 405, "text/plain", "Method Not Allowed");
 }
 
+/***************** webRoutes ****************************************************
+ * Description:
+ * All routes of the web UI and API. The route table of httpd is static,
+ * so the size is checked at compile time.
+ ******************************************************************************/
+static const HttpRoute webRoutes[] =
+{
+  { "/",             HTTPD_GET,  handleIndex },
+  { "/app.css",      HTTPD_GET,  handleAppCss },
+  { "/app.js",       HTTPD_GET,  handleAppJs },
+  { "/config",       HTTPD_POST, handleConfigPost },
+  { "/boost",        HTTPD_POST, handleBoostPost },
+  { "/nudge",        HTTPD_POST, handleNudgePost },
+  { "/nudge",        HTTPD_GET,  handleNudgeGet },
+  { "/history.json", HTTPD_GET,  handleHistoryJson },
+  { "/history.bin",  HTTPD_GET,  handleHistoryBin },
+  { "/history.csv",  HTTPD_GET,  handleHistoryCsv },
+  { "/phases.json",  HTTPD_GET,  handlePhasesJson },
+  { "/api/status",   HTTPD_GET,  handleStatusJson },
+  { "/events",       HTTPD_GET,  handleEvents },
+  { "/api/config",   HTTPD_POST, handleConfigApi },
+  { "/metrics",      HTTPD_GET,  handleMetrics },
+  { "/heaterOff",    HTTPD_POST, handleHeaterOffPost },
+};
+static_assert(sizeof(webRoutes) / sizeof(webRoutes[0]) <= HTTPD_MAX_ROUTES, "raise HTTPD_MAX_ROUTES");
+
 /***************** initWebServer ************************************************
  * params: none
  * return: void
@@ -1143,15 +1564,12 @@ static void handleNudgeGet()
  ******************************************************************************/
 void initWebServer()
 {
-  webServer.on("/", HTTP_GET, renderIndex);
-  webServer.on("/config", HTTP_POST, handleConfigPost);
-  webServer.on("/boost", HTTP_POST, handleBoostPost);
-  webServer.on("/nudge", HTTP_POST, handleNudgePost);
-  webServer.on("/nudge", HTTP_GET, handleNudgeGet);
-  webServer.on("/history.json", HTTP_GET, handleHistoryJson);
-  webServer.on("/heaterOff", HTTP_POST, handleHeaterOffPost);
+  for (const HttpRoute& r : webRoutes)
+  {
+    httpOn(r.path, r.method, r.handler);
+  }
 
-  webServer.begin();
+  initHttpd();
 }
 
 /***************** handleWebServer *********************************************
@@ -1162,5 +1580,5 @@ void initWebServer()
  ******************************************************************************/
 void handleWebServer()
 {
-  webServer.handleClient();
+  handleHttpd();
 }
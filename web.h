@@ -1,11 +1,44 @@
 #ifndef WEB_H
 #define WEB_H
 
+/***************** Configuration ************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * Work per server pass for a history download: at most HISTORY_STEP_RECORDS
+ * records are read, and only while the chunk still has
+ * HISTORY_STEP_MIN_FREE bytes left (one rollup record as JSON fits).
+ ******************************************************************************/
+#ifndef HISTORY_STEP_RECORDS
+#define HISTORY_STEP_RECORDS 256
+#endif
+
+#ifndef HISTORY_STEP_MIN_FREE
+#define HISTORY_STEP_MIN_FREE 128
+#endif
+
+/***************** Event stream *************************************************
+ * params: none
+ * return: n/a
+ * Description:
+ * /events (Server-Sent Events) holds one HTTP slot per open page, so the
+ * number of streams is capped below HTTPD_MAX_CLIENTS. An idle stream sends
+ * a keep-alive comment well within HTTPD_TIMEOUT_MS.
+ ******************************************************************************/
+#ifndef EVENTS_MAX_CLIENTS
+#define EVENTS_MAX_CLIENTS 2
+#endif
+
+#ifndef EVENTS_KEEPALIVE_MS
+#define EVENTS_KEEPALIVE_MS 5000UL
+#endif
+
 /***************** initWebServer ************************************************
  * params: none
  * return: void
  * Description:
- * Initializes a simple HTTP server to display sensor and control state.
+ * Registers the routes and starts the non-blocking HTTP server (httpd.h)
+ * that displays sensor and control state.
  ******************************************************************************/
 void initWebServer();
 
@@ -13,7 +46,8 @@ void initWebServer();
  * params: none
  * return: void
  * Description:
- * Handles incoming HTTP requests, must be called frequently in loop().
+ * One pass of the HTTP server, must be called frequently in loop(). Never
+ * waits for a client; long responses advance by one buffer per call.
  ******************************************************************************/
 void handleWebServer();
 
@@ -0,0 +1,751 @@
+// Live-Update: /events (SSE) patcht die Seite; ohne offenen Stream wie
+// bisher neu laden.
+var liveEvents = null;
+
+function afterAction()
+{
+  if (!liveEvents || liveEvents.readyState !== 1)
+  {
+    window.location.replace('/');
+  }
+}
+
+function postAction(url)
+{
+  fetch(url,{method:'POST',cache:'no-store',redirect:'manual'})
+    .then(afterAction)
+    .catch(afterAction);
+}
+
+function nudge(field,delta)
+{
+  var body='field='+encodeURIComponent(field)+'&delta='+encodeURIComponent(delta);
+  fetch('/nudge',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:body,cache:'no-store',redirect:'manual'})
+    .then(afterAction)
+    .catch(afterAction);
+}
+
+function fmtMinutes(min)
+{
+  var h = Math.floor(min / 60), m = min % 60;
+  return (h < 10 ? '0' : '') + h + ':' + (m < 10 ? '0' : '') + m;
+}
+
+function setText(id, txt)
+{
+  var el = document.getElementById(id);
+  if (el && el.textContent !== txt)
+  {
+    el.textContent = txt;
+  }
+}
+
+function setInput(name, val)
+{
+  var el = document.querySelector("[name='" + name + "']");
+  if (el && el !== document.activeElement)
+  {
+    el.value = val;
+  }
+}
+
+function applyStatus(s)
+{
+  var h = document.getElementById('stHeater');
+  if (h)
+  {
+    h.className = 'status-item ' + (s.heater ? 'status-ok' : 'status-bad');
+    h.textContent = s.heater ? '🔥 Heizung EIN' : '🔥 Heizung AUS';
+  }
+  var off = document.getElementById('btnHeaterOff');
+  if (off)
+  {
+    off.hidden = !s.heater;
+  }
+  var m = document.getElementById('stMqtt');
+  if (m)
+  {
+    m.className = 'status-item ' + (s.mqtt ? 'status-ok' : 'status-bad');
+    m.textContent = s.mqtt ? 'MQTT Verbunden' : 'MQTT Getrennt';
+  }
+  setText('stTemp', s.t === null ? 'nan' : s.t.toFixed(1));
+  setText('stSp', s.sp.toFixed(1));
+  setText('stBoostMin', String(s.boostMin));
+  var b = document.getElementById('stBoost');
+  if (b)
+  {
+    b.hidden = s.boostMin === 0;
+  }
+}
+
+function applyConfig(c)
+{
+  setInput('daySetPoint', c.daySetPoint.toFixed(1));
+  setInput('nightSetPoint', c.nightSetPoint.toFixed(1));
+  setInput('dayStart', fmtMinutes(c.dayStart));
+  setInput('nightStart', fmtMinutes(c.nightStart));
+  setInput('hysteresis', c.hysteresis.toFixed(1));
+  setInput('boostMinutes', String(c.boostMinutes));
+  setText('stSp', c.setPoint.toFixed(1));
+  schedCfg.dayStart = c.dayStart;
+  schedCfg.nightStart = c.nightStart;
+  schedCfg.daySet = c.daySetPoint;
+  schedCfg.nightSet = c.nightSetPoint;
+}
+
+// Direkte Eingaben: ein Feld pro Änderung an /api/config (ein Commit)
+document.querySelectorAll('input[name]').forEach(function(el){
+  el.addEventListener('change', function(){
+    var body = encodeURIComponent(el.name) + '=' + encodeURIComponent(el.value);
+    fetch('/api/config',{method:'POST',headers:{'Content-Type':'application/x-www-form-urlencoded'},body:body,cache:'no-store'})
+      .then(function(r){ return r.json(); })
+      .then(function(c){
+        if (c.error)
+        {
+          alert('Ungültiger Wert: ' + c.field);
+          window.location.replace('/');
+          return;
+        }
+        applyConfig(c);
+      })
+      .catch(afterAction);
+  });
+});
+
+(function(){
+  if (!window.EventSource)
+  {
+    return;
+  }
+  liveEvents = new EventSource('/events');
+  liveEvents.addEventListener('status', function(e){ applyStatus(JSON.parse(e.data)); });
+  liveEvents.addEventListener('config', function(e){ applyConfig(JSON.parse(e.data)); });
+})();
+
+// Formatter einmal anlegen: toLocale*String() baut sie bei jedem Aufruf neu
+var fmtDay  = new Intl.DateTimeFormat("de-DE", { day: "2-digit", month: "2-digit" });
+var fmtTime = new Intl.DateTimeFormat("de-DE", { hour: "2-digit", minute: "2-digit" });
+
+function formatDay(tsSec)
+{
+  return fmtDay.format(new Date(tsSec * 1000));
+}
+
+function formatTs(tsSec)
+{
+  var d = new Date(tsSec * 1000);
+  return fmtDay.format(d) + " " + fmtTime.format(d);
+}
+
+function formatTimeShort(tsSec)
+{
+  return fmtTime.format(new Date(tsSec * 1000));
+}
+
+function formatTemp(val)
+{
+  return Number(val).toFixed(1) + " °C";
+}
+
+function normalizeHistory(history)
+{
+  return history.map(function(s){
+    return {
+      ts: s.ts,
+      tC: s.t / 100.0,
+      spC: s.sp / 100.0,
+      hyC: s.hy / 100.0,
+      h: s.h
+    };
+  }).sort(function(a, b){ return a.ts - b.ts; });
+}
+
+function decodeHistoryBin(buf)
+{
+  var b = new Uint8Array(buf);
+  var pos = 0;
+  var out = [];
+
+  function varint()
+  {
+    var v = 0, mul = 1, c;
+    do
+    {
+      c = b[pos++];
+      v += (c & 0x7f) * mul;
+      mul *= 128;
+    }
+    while ((c & 0x80) && pos < b.length);
+    return v;
+  }
+
+  function zigzag()
+  {
+    var v = varint();
+    return (v % 2) ? -(v + 1) / 2 : v / 2;
+  }
+
+  if (b.length < 3 || b[0] !== 0x48 || b[1] !== 0x42 || b[2] !== 1)
+  {
+    throw new Error('bad history format');
+  }
+  pos = 3;
+  var interval = varint();
+  var ts = 0, t = 0, sp = 0, hy = 0;
+
+  while (pos < b.length)
+  {
+    var tag = b[pos++];
+    ts += interval + ((tag & 4) ? zigzag() : 0);
+    t  += zigzag();
+    if (tag & 2)
+    {
+      sp += zigzag();
+      hy += zigzag();
+    }
+    var rec = { ts: ts, t: t, sp: sp, hy: hy, h: tag & 1 };
+    if (tag & 8)
+    {
+      rec.mn = t + zigzag();
+      rec.mx = t + zigzag();
+      rec.d  = b[pos++];
+    }
+    out.push(rec);
+  }
+  return out;
+}
+
+function formatDuration(sec)
+{
+  var m = Math.round(sec / 60);
+  return (m >= 60 ? Math.floor(m / 60) + " h " : "") + (m % 60) + " min";
+}
+
+var EPOCH_MIN = 1609459200;   // wie validEpoch() in ntp.cpp, darunter Uptime-Sekunden
+
+function buildPhaseRows(phases)
+{
+  return phases.map(function(p, i){
+    // Ein/Aus nur mit derselben Zeitbasis (Epoch/Uptime) zu einer Dauer verrechnen
+    var paired = (p.off !== null) && ((p.on >= EPOCH_MIN) === (p.off >= EPOCH_MIN)) && p.off >= p.on;
+    var last = (i === phases.length - 1);
+    var spC = p.sp / 100.0;
+    var hyC = p.hy / 100.0;
+    return {
+      onTime: formatTs(p.on),
+      offTime: paired ? formatTs(p.off) : ((p.off === null && last) ? "läuft" : "?"),
+      duration: paired ? formatDuration(p.off - p.on) : "–",
+      tempOn: formatTemp(p.tOn / 100.0),
+      tempOff: (!paired || p.tOff === null) ? "–" : formatTemp(p.tOff / 100.0),
+      thresh: (spC - hyC).toFixed(1) + " °C / " + spC.toFixed(1) + " °C"
+    };
+  });
+}
+
+(function(){
+  var svg = document.getElementById('histSvg');
+  var tableWrap = document.getElementById('histTableWrap');
+  var chartWrap = document.getElementById('histChartWrap');
+  var viewBtns = document.querySelectorAll('[data-view]');
+  if (!svg || !tableWrap || !chartWrap)
+  {
+    return;
+  }
+
+  function setView(mode)
+  {
+    if (mode === 'table')
+    {
+      chartWrap.style.display = 'none';
+      tableWrap.style.display = 'block';
+    }
+    else
+    {
+      chartWrap.style.display = 'block';
+      tableWrap.style.display = 'none';
+    }
+  }
+
+  viewBtns.forEach(function(b){
+    b.addEventListener('click', function(){
+      setView(b.getAttribute('data-view'));
+    });
+  });
+
+  var CHART_WINDOW = 86400;   // angezeigtes Zeitfenster in s (bis 14 Tage)
+
+  // Verlauf der Sitzung: { next: Cursor (afterSeq), rows: [...] }
+  var HIST_KEY = 'heatctl.history';
+
+  function loadHistoryCache()
+  {
+    try
+    {
+      var c = JSON.parse(sessionStorage.getItem(HIST_KEY));
+      return (c && typeof c.next === 'number' && Array.isArray(c.rows)) ? c : null;
+    }
+    catch (e)
+    {
+      return null;
+    }
+  }
+
+  function saveHistoryCache(c)
+  {
+    try
+    {
+      sessionStorage.setItem(HIST_KEY, JSON.stringify(c));
+    }
+    catch (e)
+    {
+      sessionStorage.removeItem(HIST_KEY);
+    }
+  }
+
+  function fetchHistoryBin(query)
+  {
+    return fetch('/history.bin?' + query, { cache: 'no-store' })
+      .then(function(r){
+        if (!r.ok)
+        {
+          throw new Error('history ' + r.status);
+        }
+        var cur = r.headers.get('X-History-Cursor');
+        return r.arrayBuffer().then(function(buf){
+          return { next: cur === null ? null : Number(cur), rows: decodeHistoryBin(buf) };
+        });
+      });
+  }
+
+  // Erstes Laden: ganzes Fenster; danach nur noch Samples ab dem Cursor
+  function fetchHistory()
+  {
+    var cache = loadHistoryCache();
+    if (!cache)
+    {
+      return fetchHistoryBin('days=' + Math.ceil(CHART_WINDOW / 86400) + '&tier=raw&maxPoints=600').then(function(res){
+        if (res.next !== null)
+        {
+          saveHistoryCache(res);
+        }
+        return res.rows;
+      });
+    }
+
+    return fetchHistoryBin('afterSeq=' + cache.next).then(function(res){
+      if (res.next === null || res.next < cache.next)
+      {
+        // History neu angelegt (Reset/Format): alles verwerfen
+        sessionStorage.removeItem(HIST_KEY);
+        return fetchHistory();
+      }
+      var rows = cache.rows.concat(res.rows);
+      var last = rows.length ? rows[rows.length - 1].ts : 0;
+      rows = rows.filter(function(s){ return s.ts > last - CHART_WINDOW; });
+      saveHistoryCache({ next: res.next, rows: rows });
+      return rows;
+    });
+  }
+
+  function clearSvg()
+  {
+    while (svg.firstChild)
+    {
+      svg.removeChild(svg.firstChild);
+    }
+  }
+
+  function drawText(x,y,txt,cls)
+  {
+    var t = document.createElementNS('http://www.w3.org/2000/svg','text');
+    t.setAttribute('x', x);
+    t.setAttribute('y', y);
+    t.textContent = txt;
+    t.setAttribute('fill', 'currentColor');
+    t.setAttribute('font-size', '12');
+    if (cls)
+    {
+      t.setAttribute('class', cls);
+    }
+    svg.appendChild(t);
+    return t;
+  }
+
+  function drawLine(x1,y1,x2,y2,stroke,width)
+  {
+    var l = document.createElementNS('http://www.w3.org/2000/svg','line');
+    l.setAttribute('x1', x1);
+    l.setAttribute('y1', y1);
+    l.setAttribute('x2', x2);
+    l.setAttribute('y2', y2);
+    l.setAttribute('stroke', stroke);
+    l.setAttribute('stroke-width', width || 1);
+    l.setAttribute('opacity', '0.5');
+    svg.appendChild(l);
+    return l;
+  }
+
+  function drawPath(d,stroke,width)
+  {
+    var p = document.createElementNS('http://www.w3.org/2000/svg','path');
+    p.setAttribute('d', d);
+    p.setAttribute('fill', 'none');
+    p.setAttribute('stroke', stroke);
+    p.setAttribute('stroke-width', width || 2);
+    svg.appendChild(p);
+    return p;
+  }
+
+  function fetchPhases()
+  {
+    return fetch('/phases.json?days=1', { cache: 'no-store' })
+      .then(function(r){ return r.json(); });
+  }
+
+  function renderTable(phases)
+  {
+    var tableRows = buildPhaseRows(phases);
+    if (!tableRows.length)
+    {
+      tableWrap.innerHTML = "<div class='muted'>Keine Heizphasen im Verlauf</div>";
+      return;
+    }
+
+    var html = "<table><thead><tr><th>Ein</th><th>Aus</th><th>Dauer</th><th>Temp Ein</th><th>Temp Aus</th><th>Schwelle</th></tr></thead><tbody>";
+    tableRows.forEach(function(r){
+      html += "<tr><td>" + r.onTime + "</td><td>" + r.offTime + "</td><td>" + r.duration + "</td><td>" + r.tempOn + "</td><td>" + r.tempOff + "</td><td>" + r.thresh + "</td></tr>";
+    });
+    html += "</tbody></table>";
+    tableWrap.innerHTML = html;
+  }
+
+  var SVG_NS = 'http://www.w3.org/2000/svg';
+
+  function svgEl(tag, attrs)
+  {
+    var e = document.createElementNS(SVG_NS, tag);
+    for (var k in attrs)
+    {
+      e.setAttribute(k, attrs[k]);
+    }
+    svg.appendChild(e);
+    return e;
+  }
+
+  // erster Index mit list[i] >= v (list aufsteigend sortiert)
+  function lowerBound(list, v, lo, hi)
+  {
+    while (lo < hi)
+    {
+      var mid = (lo + hi) >> 1;
+      if (list[mid] < v)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  function r1(v)
+  {
+    return Math.round(v * 10) / 10;
+  }
+
+  // Min/Max-Dezimierung pro Pixelspalte: je Spalte erster, kleinster,
+  // größter und letzter Punkt. Sieht aus wie alle Punkte, ist aber auf
+  // 4 Punkte pro Pixel begrenzt, egal wie viele Samples im Fenster liegen.
+  function decimatedPath(xs, vals, yFor)
+  {
+    var d = [];
+    var col = -1, iF = 0, iMin = 0, iMax = 0, iL = 0, prev = -1;
+
+    function emit(i)
+    {
+      if (i !== prev)
+      {
+        d.push((prev < 0 ? 'M' : 'L') + r1(xs[i]) + ' ' + r1(yFor(vals[i])));
+        prev = i;
+      }
+    }
+
+    function flush()
+    {
+      emit(iF);
+      emit(iMin < iMax ? iMin : iMax);
+      emit(iMin < iMax ? iMax : iMin);
+      emit(iL);
+    }
+
+    for (var i = 0; i < xs.length; i++)
+    {
+      var c = Math.floor(xs[i]);
+      if (c !== col)
+      {
+        if (col >= 0)
+        {
+          flush();
+        }
+        col = c;
+        iF = iMin = iMax = iL = i;
+        continue;
+      }
+      iL = i;
+      if (vals[i] < vals[iMin]) { iMin = i; }
+      if (vals[i] > vals[iMax]) { iMax = i; }
+    }
+    if (col >= 0)
+    {
+      flush();
+    }
+    return d.join('');
+  }
+
+  function renderChart(rows)
+  {
+    clearSvg();
+    if (!rows.length)
+    {
+      drawText(10, 20, 'Keine Verlaufsdaten verfügbar.', '');
+      return;
+    }
+
+    var width = 600;
+    var height = 320;
+    var padL = 50, padR = 10, padT = 10, padB = 30;
+    var plotW = width - padL - padR;
+    var top = padT, bottom = height - padB;
+
+    // rows ist nach ts sortiert: Fenster per Binärsuche statt Filterschleife
+    var allTs = new Array(rows.length);
+    for (var i = 0; i < rows.length; i++)
+    {
+      allTs[i] = Number(rows[i].ts) || 0;
+    }
+    var maxTs = allTs[allTs.length - 1];
+    var minTs = maxTs > CHART_WINDOW ? (maxTs - CHART_WINDOW) : allTs[0];
+    var first = lowerBound(allTs, minTs, 0, allTs.length);
+    // letztes Sample vor dem Fenster hält den Wert am linken Rand
+    if (first > 0)
+    {
+      first--;
+    }
+    if (maxTs <= minTs)
+    {
+      maxTs = minTs + CHART_WINDOW;
+    }
+    var tsSpan = maxTs - minTs;
+
+    var n = rows.length - first;
+    var tsList = new Array(n);
+    var xs = new Array(n);
+    var temps = new Array(n);
+    var uppers = new Array(n);
+    var lowers = new Array(n);
+    var minV = Infinity, maxV = -Infinity;
+
+    for (var j = 0; j < n; j++)
+    {
+      var r = rows[first + j];
+      var ts = Math.max(allTs[first + j], minTs);
+      var tVal = Number(r.tC) || 0;
+      var spVal = Number(r.spC) || 0;
+      var hyVal = Number(r.hyC) || 0;
+
+      tsList[j] = ts;
+      xs[j] = padL + (ts - minTs) / tsSpan * plotW;
+      temps[j] = tVal;
+      uppers[j] = spVal + hyVal;
+      lowers[j] = spVal - hyVal;
+      minV = Math.min(minV, tVal, lowers[j]);
+      maxV = Math.max(maxV, tVal, uppers[j]);
+    }
+    if (maxV - minV < 0.5)
+    {
+      minV -= 0.5;
+      maxV += 0.5;
+    }
+    var vSpan = maxV - minV;
+
+    function xForTs(ts)
+    {
+      return padL + (ts - minTs) / tsSpan * plotW;
+    }
+
+    function yFor(val)
+    {
+      return top + (1.0 - (val - minV) / vSpan) * (bottom - top);
+    }
+
+    svgEl('rect', { x: 0, y: 0, width: width, height: height, 'class': 'bg' });
+
+    // Heizphasen als ein Pfad; Bänder, die sich im selben Pixel berühren,
+    // werden zusammengelegt
+    var bands = [];
+    var bandX = -1, bandStart = 0, bandEnd = -1;
+    for (var s = 0; s < n; s++)
+    {
+      var on = rows[first + s].h;
+      if (on && bandX < 0)
+      {
+        bandX = xs[s];
+      }
+      else if (!on && bandX >= 0)
+      {
+        bands.push(bandX, xs[s]);
+        bandX = -1;
+      }
+    }
+    if (bandX >= 0)
+    {
+      bands.push(bandX, xs[n - 1]);
+    }
+    var bandD = [];
+    for (var b = 0; b < bands.length; b += 2)
+    {
+      var x1 = bands[b], x2 = Math.max(bands[b + 1], x1 + 1);
+      if (bandD.length && x1 <= bandEnd + 1)
+      {
+        bandD.pop();
+        x1 = bandStart;
+      }
+      bandStart = x1;
+      bandEnd = x2;
+      bandD.push('M' + r1(x1) + ' ' + top + 'H' + r1(x2) + 'V' + bottom + 'H' + r1(x1) + 'Z');
+    }
+    if (bandD.length)
+    {
+      svgEl('path', { d: bandD.join(''), 'class': 'heat-on-band' });
+    }
+
+    var grid = [];
+    var yTicks = 5;
+    for (var t = 0; t < yTicks; t++)
+    {
+      var val = minV + (vSpan * (t / (yTicks - 1)));
+      var y = r1(yFor(val));
+      grid.push('M' + padL + ' ' + y + 'H' + (width - padR));
+      svgEl('text', { x: padL - 4, y: y + 3, 'text-anchor': 'end', 'class': 'axis-label' }).textContent = val.toFixed(1);
+    }
+    svgEl('path', { d: grid.join(''), 'class': 'grid-line' });
+
+    // Ticks: 4 h bis 1 Tag Fenster, sonst ganze Tage
+    var multiDay = tsSpan > 2 * 86400;
+    var tickStep = multiDay ? 86400 * Math.ceil(tsSpan / (7 * 86400)) : 4 * 3600;
+    var axis = ['M' + padL + ' ' + bottom + 'H' + (width - padR)];
+    for (var tk = Math.ceil(minTs / tickStep) * tickStep; tk <= maxTs + 1; tk += tickStep)
+    {
+      var x = r1(xForTs(tk));
+      axis.push('M' + x + ' ' + bottom + 'v4');
+      svgEl('text', { x: x, y: bottom + 14, 'text-anchor': 'middle', 'class': 'axis-label' }).textContent =
+        multiDay ? formatDay(tk) : formatTimeShort(tk);
+    }
+    svgEl('path', { d: axis.join(''), 'class': 'axis' });
+
+    // Tag/Nacht-Wechsel nur bei kurzen Fenstern, sonst überlappen die Labels
+    if (!multiDay)
+    {
+      var dayStart = Number(schedCfg.dayStart) || 0;
+      var nightStart = Number(schedCfg.nightStart) || 0;
+      var phase = [];
+      var ti = 0;
+      for (var base = Math.floor(minTs / 86400) * 86400 - 86400; base <= maxTs + 86400; base += 86400)
+      {
+        var trs = [[base + dayStart * 60, 'Tag'], [base + nightStart * 60, 'Nacht']];
+        for (var q = 0; q < 2; q++, ti++)
+        {
+          var trTs = trs[q][0];
+          if (trTs < minTs || trTs > maxTs) { continue; }
+          var xTr = r1(xForTs(trTs));
+          phase.push('M' + xTr + ' ' + top + 'V' + bottom);
+          svgEl('text', { x: xTr + 2, y: top + 12 + (ti % 2) * 12, 'class': 'axis-label' }).textContent =
+            formatTimeShort(trTs) + ' ' + trs[q][1];
+        }
+      }
+      if (phase.length)
+      {
+        svgEl('path', { d: phase.join(''), 'class': 'phase-line' });
+      }
+    }
+
+    var tempD = decimatedPath(xs, temps, yFor);
+    svgEl('path', { d: tempD, 'class': 'temp-glow' });
+    svgEl('path', { d: tempD, 'class': 'temp-line' });
+    svgEl('path', { d: decimatedPath(xs, uppers, yFor), 'class': 'upper-line' });
+    svgEl('path', { d: decimatedPath(xs, lowers, yFor), 'class': 'lower-line' });
+
+    drawText(15, padT + 10, '°C', 'axis-label');
+
+    var hoverLine = svgEl('line', { y1: top, y2: bottom, 'class': 'hover-line' });
+    var hoverDot = svgEl('circle', { r: 3, 'class': 'hover-dot' });
+    var hoverText = svgEl('text', { x: padL + 5, y: padT + 15, 'class': 'hover-text' });
+    var overlay = svgEl('rect', { x: padL, y: top, width: plotW, height: bottom - top, fill: 'transparent' });
+    overlay.style.cursor = 'crosshair';
+
+    function hideHover()
+    {
+      hoverLine.style.display = 'none';
+      hoverDot.style.display = 'none';
+      hoverText.style.display = 'none';
+    }
+    hideHover();
+
+    function showHover(evt)
+    {
+      var pt = svg.createSVGPoint();
+      pt.x = evt.clientX;
+      pt.y = evt.clientY;
+      var x = pt.matrixTransform(svg.getScreenCTM().inverse()).x;
+
+      if (x < padL || x > (width - padR))
+      {
+        hideHover();
+        return;
+      }
+
+      // nächstliegendes Sample per Binärsuche
+      var targetTs = minTs + (x - padL) / plotW * tsSpan;
+      var idx = lowerBound(tsList, targetTs, 0, n);
+      if (idx >= n || (idx > 0 && targetTs - tsList[idx - 1] < tsList[idx] - targetTs))
+      {
+        idx--;
+      }
+
+      var xv = xs[idx];
+      hoverLine.setAttribute('x1', xv);
+      hoverLine.setAttribute('x2', xv);
+      hoverLine.style.display = 'block';
+
+      hoverDot.setAttribute('cx', xv);
+      hoverDot.setAttribute('cy', yFor(temps[idx]));
+      hoverDot.style.display = 'block';
+
+      hoverText.textContent = formatTs(tsList[idx]) + "  " + formatTemp(temps[idx]);
+      hoverText.style.display = 'block';
+    }
+
+    overlay.addEventListener('mousemove', showHover);
+    overlay.addEventListener('mouseleave', hideHover);
+  }
+
+  fetchHistory()
+    .then(function(data){
+      renderChart(normalizeHistory(data || []));
+    })
+    .catch(function(){
+      clearSvg();
+      drawText(20, 40, "Verlauf konnte nicht geladen werden", "");
+    });
+
+  fetchPhases()
+    .then(function(phases){
+      renderTable(phases || []);
+    })
+    .catch(function(){
+      tableWrap.innerHTML = "<div class='muted'>Heizphasen konnten nicht geladen werden</div>";
+    });
+
+})();